@@ -0,0 +1,47 @@
+#include <cat/page_allocator>
+#include <cat/slab_allocator>
+
+// This allocates and frees many small objects of mixed sizes. Compare its run
+// time against `allocate_page` and `allocate_libc` with an external tool, such
+// as `perf stat`.
+//
+// `allocate_slab` is compiled from this file with a `slab_allocator`, and
+// `allocate_page` is compiled with a `page_allocator`.
+
+// Keep this workload identical to `allocate_libc.cpp`.
+inline constexpr cat::idx live_allocations = 4'096u;
+inline constexpr cat::idx rounds = 256u;
+
+auto main() -> int {
+#ifdef CAT_ALLOCATE_PAGES
+    cat::page_allocator allocator;
+#else
+    cat::slab_allocator allocator;
+#endif
+
+    cat::byte* allocations[live_allocations.raw];
+    cat::idx sizes[live_allocations.raw];
+
+    for (cat::idx i = 0u; i < live_allocations; ++i) {
+        // Cycle through sizes from 16 to 1024 bytes.
+        sizes[i.raw] = cat::idx(16u) << (i % 7u);
+        allocations[i.raw] =
+            allocator.alloc_multi<cat::byte>(sizes[i.raw]).or_exit().data();
+    }
+
+    for (cat::idx round = 0u; round < rounds; ++round) {
+        // Free and reallocate every other allocation, so that free lists are
+        // exercised in a different order each round.
+        for (cat::idx i = round % 2u; i < live_allocations; i += 2u) {
+            allocator.free_multi(allocations[i.raw], sizes[i.raw]);
+            allocations[i.raw] =
+                allocator.alloc_multi<cat::byte>(sizes[i.raw]).or_exit().data();
+            // Prevent this from being optimized out.
+            asm volatile("" ::"r"(allocations[i.raw]) : "memory");
+        }
+    }
+
+    for (cat::idx i = 0u; i < live_allocations; ++i) {
+        allocator.free_multi(allocations[i.raw], sizes[i.raw]);
+    }
+}
@@ -0,0 +1,33 @@
+#include <cstdint>
+#include <cstdlib>
+
+// Keep this workload identical to `allocate.cpp`.
+inline constexpr std::size_t live_allocations = 4'096u;
+inline constexpr std::size_t rounds = 256u;
+
+auto main() -> int32_t {
+    void* allocations[live_allocations];
+    std::size_t sizes[live_allocations];
+
+    for (std::size_t i = 0u; i < live_allocations; ++i) {
+        // Cycle through sizes from 16 to 1024 bytes.
+        sizes[i] = std::size_t(16u) << (i % 7u);
+        allocations[i] = malloc(sizes[i]);
+    }
+
+    for (std::size_t round = 0u; round < rounds; ++round) {
+        // Free and reallocate every other allocation, so that free lists are
+        // exercised in a different order each round.
+        for (std::size_t i = round % 2u; i < live_allocations; i += 2u) {
+            free(allocations[i]);
+            allocations[i] = malloc(sizes[i]);
+            // Prevent this from being optimized out.
+            asm volatile("" ::"r"(allocations[i]) : "memory");
+        }
+    }
+
+    for (std::size_t i = 0u; i < live_allocations; ++i) {
+        free(allocations[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include <cat/checksum>
+#include <cat/format>
+#include <cat/page_allocator>
+
+// This compares the throughput of libCat's checksums against portable
+// byte-at-a-time implementations, like those in most C libraries.
+
+inline constexpr cat::idx buffer_bytes = 64u * 1'024u * 1'024u;
+
+// A CRC-32C table holds the CRC of every byte value, so that the CRC advances
+// one byte per lookup.
+struct crc32c_table {
+    uint4::raw_type entries[256];
+};
+
+consteval auto make_crc32c_table() -> crc32c_table {
+    crc32c_table table = {};
+    for (uint4::raw_type value = 0u; value < 256u; ++value) {
+        uint4::raw_type crc = value;
+        for (int4::raw_type bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1u) ^ ((crc & 1u) != 0u ? 0x82f6'3b78u : 0u);
+        }
+        table.entries[value] = crc;
+    }
+    return table;
+}
+
+inline constexpr crc32c_table crc32c_lookup = make_crc32c_table();
+
+auto table_crc32c(cat::span<cat::byte const> bytes) -> cat::uint4 {
+    uint4::raw_type crc = 0xffff'ffffu;
+    for (cat::byte value : bytes) {
+        crc = crc32c_lookup.entries[(crc ^ value.value) & 0xffu] ^ (crc >> 8u);
+    }
+    return ~crc;
+}
+
+// These reduce their sums once per block that cannot overflow, as zlib does.
+auto scalar_adler32(cat::span<cat::byte const> bytes) -> cat::uint4 {
+    uint4::raw_type sum_1 = 1u;
+    uint4::raw_type sum_2 = 0u;
+    for (cat::idx i = 0u; i < bytes.size(); i += 5'552u) {
+        cat::idx const end = cat::min(i + 5'552u, bytes.size());
+        for (cat::idx j = i; j < end; ++j) {
+            sum_1 += bytes[j].value;
+            sum_2 += sum_1;
+        }
+        sum_1 %= 65'521u;
+        sum_2 %= 65'521u;
+    }
+    return (sum_2 << 16u) | sum_1;
+}
+
+auto scalar_fletcher32(cat::span<cat::byte const> bytes) -> cat::uint4 {
+    uint4::raw_type sum_1 = 0u;
+    uint4::raw_type sum_2 = 0u;
+    for (cat::idx i = 0u; i + 1u < bytes.size(); i += 2u * 359u) {
+        cat::idx const end = cat::min(i + 2u * 359u, bytes.size() - 1u);
+        for (cat::idx j = i; j < end; j += 2u) {
+            sum_1 += bytes[j].value | (uint4::raw_type(bytes[j + 1u].value)
+                                       << 8u);
+            sum_2 += sum_1;
+        }
+        sum_1 %= 65'535u;
+        sum_2 %= 65'535u;
+    }
+    return (sum_2 << 16u) | sum_1;
+}
+
+void measure(cat::page_allocator& pager, cat::string name,
+             cat::span<cat::byte const> buffer,
+             auto (*p_checksum)(cat::span<cat::byte const>)->cat::uint4) {
+    cat::uint8 const start = __builtin_ia32_rdtsc();
+    cat::uint4 const checksum = p_checksum(buffer);
+    cat::uint8 const cycles = __builtin_ia32_rdtsc() - start;
+
+    cat::uint8 const bytes_per_100_cycles =
+        cat::uint8(buffer.size().raw) * 100u / cycles;
+    _ = cat::print(cat::format(pager, "{}: {} bytes per 100 cycles ({})\n",
+                               name, bytes_per_100_cycles, checksum)
+                       .or_exit());
+}
+
+auto main() -> int {
+    cat::page_allocator pager;
+    cat::span<cat::byte> buffer =
+        pager.alloc_multi<cat::byte>(buffer_bytes).or_exit("Failed to map!");
+    for (cat::idx i = 0u; i < buffer_bytes; ++i) {
+        buffer[i] = static_cast<unsigned char>(i.raw * 167u);
+    }
+
+    measure(pager, "table CRC-32C", buffer, table_crc32c);
+    measure(pager, "CRC-32C", buffer, cat::crc32c);
+    measure(pager, "scalar Adler-32", buffer, scalar_adler32);
+    measure(pager, "Adler-32", buffer, cat::adler32);
+    measure(pager, "scalar Fletcher-32", buffer, scalar_fletcher32);
+    measure(pager, "Fletcher-32", buffer, cat::fletcher32);
+    pager.free_multi(buffer.data(), buffer_bytes);
+}
@@ -0,0 +1,73 @@
+#include <cat/atomic>
+#include <cat/concurrent_pool_allocator>
+#include <cat/format>
+#include <cat/page_allocator>
+#include <cat/runtime>
+#include <cat/string>
+#include <cat/thread>
+
+// This measures the throughput of one `concurrent_pool_allocator` shared
+// between 1 to 8 threads, in CPU cycles per allocation and free.
+
+inline constexpr cat::iword iterations = 1'000'000;
+inline constexpr cat::iword max_threads_count = 8;
+
+struct benchmark_arguments {
+    cat::concurrent_pool_allocator<64>* p_pool;
+    cat::atomic<bool> is_started = false;
+    cat::atomic<cat::iword::raw_type> finished_threads = 0;
+};
+
+void churn(void* p_arguments) {
+    benchmark_arguments& arguments =
+        *static_cast<benchmark_arguments*>(p_arguments);
+
+    // Start every thread at once.
+    while (!arguments.is_started.load(cat::memory_order::acquire)) {
+        cat::relax_cpu();
+    }
+
+    for (cat::iword i = 0; i < iterations; ++i) {
+        cat::maybe maybe_node = arguments.p_pool->alloc<cat::uint8>();
+        if (maybe_node.has_value()) {
+            arguments.p_pool->free(maybe_node.value());
+        }
+    }
+
+    _ = arguments.finished_threads.fetch_add(1, cat::memory_order::release);
+    cat::exit();
+}
+
+auto main() -> int {
+    cat::page_allocator pager;
+    cat::concurrent_pool_allocator<64> pool =
+        cat::concurrent_pool_allocator<64>::backed(pager, 64_ki).or_exit();
+
+    for (cat::iword threads_count = 1; threads_count <= max_threads_count;
+         threads_count = threads_count * 2) {
+        benchmark_arguments arguments;
+        arguments.p_pool = &pool;
+
+        cat::thread threads[max_threads_count.raw];
+        for (cat::iword i = 0; i < threads_count; ++i) {
+            threads[i.raw]
+                .create(pager, 64_uki, churn, &arguments)
+                .or_exit("Failed to make thread!");
+        }
+
+        cat::uint8 const start_cycles = __builtin_ia32_rdtsc();
+        arguments.is_started.store(true, cat::memory_order::release);
+        while (arguments.finished_threads.load(cat::memory_order::acquire) <
+               threads_count) {
+            cat::relax_cpu();
+        }
+        cat::uint8 const cycles = __builtin_ia32_rdtsc() - start_cycles;
+
+        cat::uint8 const operations =
+            cat::uint8(threads_count) * cat::uint8(iterations);
+        _ = cat::print(
+            cat::format(pager, "{} threads: {} cycles per allocation\n",
+                        threads_count, cycles / operations)
+                .or_exit());
+    }
+}
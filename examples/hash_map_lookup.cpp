@@ -0,0 +1,69 @@
+#include <cat/format>
+#include <cat/hash_map>
+#include <cat/page_allocator>
+#include <cat/string>
+
+// This measures the mean cost of inserting keys into a `hash_map`, of finding
+// keys which are in it, and of finding keys which are not, from a map that
+// fits in cache to one that is far larger than it.
+
+inline constexpr cat::idx entry_counts[] = {1'000u, 1'000'000u,
+                                            100'000'000u};
+
+// Keys which are in the map are even, and keys which are not are odd.
+auto hit_key(cat::idx i) -> cat::uint8 {
+    return cat::uint8(i.raw) * 2u;
+}
+
+auto miss_key(cat::idx i) -> cat::uint8 {
+    return cat::uint8(i.raw) * 2u + 1u;
+}
+
+void measure(cat::page_allocator& pager, cat::idx entries) {
+    cat::hash_map<cat::uint8, cat::uint8> map;
+    // Reserving up front keeps rehashing out of the insertion times.
+    map.reserve(pager, entries).or_exit("Failed to reserve a table!");
+
+    cat::uint8 const insert_start = __builtin_ia32_rdtsc();
+    for (cat::idx i = 0u; i < entries; ++i) {
+        _ = map.insert(pager, hit_key(i), cat::uint8(i.raw))
+                .or_exit("Failed to insert!");
+    }
+    cat::uint8 const insert_cycles = __builtin_ia32_rdtsc() - insert_start;
+
+    // Sum the values found, so that the lookups are not optimized out.
+    cat::uint8 sum = 0u;
+    cat::uint8 const hit_start = __builtin_ia32_rdtsc();
+    for (cat::idx i = 0u; i < entries; ++i) {
+        sum += map.find(hit_key(i)).value();
+    }
+    cat::uint8 const hit_cycles = __builtin_ia32_rdtsc() - hit_start;
+
+    cat::idx misses = 0u;
+    cat::uint8 const miss_start = __builtin_ia32_rdtsc();
+    for (cat::idx i = 0u; i < entries; ++i) {
+        misses += map.contains(miss_key(i)) ? 0u : 1u;
+    }
+    cat::uint8 const miss_cycles = __builtin_ia32_rdtsc() - miss_start;
+
+    if (misses != entries) {
+        cat::exit(1);
+    }
+
+    _ = cat::print(
+        cat::format(pager,
+                    "{} entries:\n    insert: {} cycles\n"
+                    "    hit lookup: {} cycles\n    miss lookup: {} cycles\n"
+                    "    (checksum {})\n",
+                    entries, insert_cycles / entries.raw,
+                    hit_cycles / entries.raw, miss_cycles / entries.raw, sum)
+            .or_exit());
+    map.free(pager);
+}
+
+auto main() -> int {
+    cat::page_allocator pager;
+    for (cat::idx entries : entry_counts) {
+        measure(pager, entries);
+    }
+}
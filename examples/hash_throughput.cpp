@@ -0,0 +1,50 @@
+#include <cat/format>
+#include <cat/hash>
+#include <cat/page_allocator>
+
+// This measures how many bytes `hash_bytes()` consumes per cycle, from short
+// keys hashed by `rapidhash()` to buffers far larger than cache, which are
+// hashed by `aes_hash()`.
+
+inline constexpr cat::idx buffer_bytes = 256u * 1'024u * 1'024u;
+
+inline constexpr cat::idx input_lengths[] = {
+    16u, 64u, 256u, 4'096u, 1'024u * 1'024u, buffer_bytes};
+
+void measure(cat::page_allocator& pager, cat::span<cat::byte const> buffer,
+             cat::idx length) {
+    // Hash the whole buffer in inputs of `length` bytes.
+    cat::idx const inputs = buffer.size() / length;
+    cat::uint8 checksum = 0u;
+    cat::uint8 const start = __builtin_ia32_rdtsc();
+    for (cat::idx i = 0u; i < inputs; ++i) {
+        checksum ^= cat::hash_bytes(
+            cat::span<cat::byte const>(buffer.data() + (i * length).raw,
+                                       length));
+    }
+    cat::uint8 const cycles = __builtin_ia32_rdtsc() - start;
+
+    cat::uint8 const bytes_per_100_cycles =
+        cat::uint8(buffer.size().raw) * 100u / cycles;
+    _ = cat::print(
+        cat::format(pager,
+                    "{} byte inputs: {} cycles per input, {} bytes per 100 "
+                    "cycles\n    (checksum {})\n",
+                    length, cycles / inputs.raw, bytes_per_100_cycles,
+                    checksum)
+            .or_exit());
+}
+
+auto main() -> int {
+    cat::page_allocator pager;
+    cat::span<cat::byte> buffer =
+        pager.alloc_multi<cat::byte>(buffer_bytes).or_exit("Failed to map!");
+    // Touch every page, so that page faults are not measured.
+    cat::set_memory(buffer.data(), static_cast<unsigned char>(0x5a),
+                    buffer_bytes);
+
+    for (cat::idx length : input_lengths) {
+        measure(pager, buffer, length);
+    }
+    pager.free_multi(buffer.data(), buffer_bytes);
+}
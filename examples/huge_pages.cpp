@@ -0,0 +1,55 @@
+#include <cat/format>
+#include <cat/huge_page_allocator>
+#include <cat/page_allocator>
+#include <cat/string>
+
+// This measures random access over a 1 gibibyte arena, which misses the TLB on
+// nearly every access, when that arena is mapped with normal pages and with
+// huge pages.
+
+inline constexpr cat::idx arena_bytes = 1_ugi;
+inline constexpr cat::idx accesses = 10'000'000u;
+
+auto random_access(cat::span<cat::uint8> arena) -> cat::uint8 {
+    // Write every word once, so that every page is faulted in before timing.
+    for (cat::uint8& word : arena) {
+        word = 1u;
+    }
+
+    // A xorshift generator is cheap enough to not dominate the loop.
+    cat::uint8 state = 0x9e37'79b9'7f4a'7c15u;
+    cat::uint8 sum = 0u;
+    cat::uint8 const start_cycles = __builtin_ia32_rdtsc();
+    for (cat::idx i = 0u; i < accesses; ++i) {
+        state ^= state << 13u;
+        state ^= state >> 7u;
+        state ^= state << 17u;
+        // The arena's size is a power of two.
+        sum += arena[state.raw & (arena.size().raw - 1u)];
+    }
+    cat::uint8 const cycles = __builtin_ia32_rdtsc() - start_cycles;
+    // Prevent the loop from being optimized out.
+    asm volatile("" ::"r"(sum.raw));
+    return cycles / cat::uint8(accesses);
+}
+
+auto main() -> int {
+    cat::idx const words = arena_bytes / 8u;
+
+    cat::page_allocator pager;
+    cat::span small_arena = pager.alloc_multi<cat::uint8>(words).or_exit();
+    cat::uint8 const small_cycles = random_access(small_arena);
+    pager.free(small_arena);
+
+    cat::huge_page_allocator huge_allocator;
+    cat::span huge_arena =
+        huge_allocator.alloc_multi<cat::uint8>(words).or_exit();
+    cat::uint8 const huge_cycles = random_access(huge_arena);
+    huge_allocator.free(huge_arena);
+
+    _ = cat::print(cat::format(pager,
+                               "4 KiB pages: {} cycles per access\n"
+                               "2 MiB pages: {} cycles per access\n",
+                               small_cycles, huge_cycles)
+                       .or_exit());
+}
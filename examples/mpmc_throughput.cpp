@@ -0,0 +1,104 @@
+#include <cat/atomic>
+#include <cat/format>
+#include <cat/mpmc_ring>
+#include <cat/page_allocator>
+#include <cat/runtime>
+#include <cat/thread>
+
+// This measures the throughput of one `mpmc_ring` shared between 1 to 8 pairs
+// of producer and consumer threads, in CPU cycles per element passed through
+// it.
+
+inline constexpr cat::iword elements_per_producer = 1'000'000;
+inline constexpr cat::iword max_pairs_count = 8;
+
+struct benchmark_arguments {
+    cat::mpmc_ring<cat::uint8>* p_ring;
+    cat::iword total_elements;
+    cat::atomic<bool> is_started = false;
+    cat::atomic<cat::iword::raw_type> consumed_elements = 0;
+    cat::atomic<cat::iword::raw_type> finished_threads = 0;
+};
+
+void wait_for_start(benchmark_arguments& arguments) {
+    // Start every thread at once.
+    while (!arguments.is_started.load(cat::memory_order::acquire)) {
+        cat::relax_cpu();
+    }
+}
+
+void produce(void* p_arguments) {
+    benchmark_arguments& arguments =
+        *static_cast<benchmark_arguments*>(p_arguments);
+    wait_for_start(arguments);
+
+    for (cat::iword i = 0; i < elements_per_producer; ++i) {
+        while (!arguments.p_ring->push(cat::uint8(i.raw))) {
+            cat::relax_cpu();
+        }
+    }
+
+    _ = arguments.finished_threads.fetch_add(1, cat::memory_order::release);
+    cat::exit();
+}
+
+void consume(void* p_arguments) {
+    benchmark_arguments& arguments =
+        *static_cast<benchmark_arguments*>(p_arguments);
+    wait_for_start(arguments);
+
+    while (arguments.consumed_elements.load(cat::memory_order::relaxed) <
+           arguments.total_elements) {
+        if (arguments.p_ring->pop().has_value()) {
+            _ = arguments.consumed_elements.fetch_add(
+                1, cat::memory_order::relaxed);
+        } else {
+            cat::relax_cpu();
+        }
+    }
+
+    _ = arguments.finished_threads.fetch_add(1, cat::memory_order::release);
+    cat::exit();
+}
+
+auto main() -> int {
+    cat::page_allocator pager;
+    cat::mpmc_ring<cat::uint8> ring;
+    ring.reserve(pager, 1'024u).or_exit("Failed to reserve a ring!");
+
+    for (cat::iword pairs_count = 1; pairs_count <= max_pairs_count;
+         pairs_count = pairs_count * 2) {
+        benchmark_arguments arguments;
+        arguments.p_ring = &ring;
+        arguments.total_elements = pairs_count * elements_per_producer;
+
+        cat::thread threads[max_pairs_count.raw * 2];
+        for (cat::iword i = 0; i < pairs_count; ++i) {
+            threads[i.raw * 2]
+                .create(pager, 64_uki, produce, &arguments)
+                .or_exit("Failed to make thread!");
+            threads[i.raw * 2 + 1]
+                .create(pager, 64_uki, consume, &arguments)
+                .or_exit("Failed to make thread!");
+        }
+
+        cat::uint8 const start_cycles = __builtin_ia32_rdtsc();
+        arguments.is_started.store(true, cat::memory_order::release);
+        while (arguments.finished_threads.load(cat::memory_order::acquire) <
+               pairs_count * 2) {
+            cat::relax_cpu();
+        }
+        cat::uint8 const cycles = __builtin_ia32_rdtsc() - start_cycles;
+
+        for (cat::iword i = 0; i < pairs_count * 2; ++i) {
+            threads[i.raw].join().or_exit("Failed to join thread!");
+        }
+
+        _ = cat::print(
+            cat::format(pager, "{} pairs: {} cycles per element\n",
+                        pairs_count,
+                        cycles / cat::uint8(arguments.total_elements))
+                .or_exit());
+    }
+    ring.free(pager);
+}
@@ -0,0 +1,123 @@
+#include <cat/format>
+#include <cat/linux>
+#include <cat/page_allocator>
+#include <cat/slab_allocator>
+#include <cat/string>
+#include <cat/trace_allocator>
+
+// This replays an allocation trace against several allocators, and compares
+// their throughput and fragmentation. Given a path, it replays a trace that was
+// written by `trace_allocator::write_events()`. Otherwise, it records and
+// replays a synthetic workload of mixed allocations, reallocations and frees.
+
+inline constexpr cat::iword trace_capacity = 65'536;
+inline constexpr cat::idx iterations = 20'000u;
+inline constexpr cat::idx live_slots = 256u;
+
+auto record_workload(cat::page_allocator& pager)
+    -> cat::span<cat::allocation_event> {
+    cat::page_allocator backing;
+    auto tracer = cat::trace_allocator<cat::page_allocator>::traced(
+                      backing, pager, trace_capacity)
+                      .or_exit("Failed to allocate a trace!");
+
+    struct live_allocation {
+        cat::byte* p_bytes = nullptr;
+        cat::idx size = 0u;
+    };
+    live_allocation slots[live_slots.raw];
+
+    // A xorshift generator picks slots and sizes.
+    cat::uint8 state = 0x9e37'79b9'7f4a'7c15u;
+    for (cat::idx i = 0u; i < iterations; ++i) {
+        state ^= state << 13u;
+        state ^= state >> 7u;
+        state ^= state << 17u;
+        live_allocation& slot = slots[state.raw % live_slots.raw];
+        cat::idx const size = 16u + (state.raw >> 32u) % 4'080u;
+
+        if (slot.p_bytes != nullptr && (state.raw & 0b11u) == 0u) {
+            // Sometimes grow an allocation, like a `vector` would.
+            slot.p_bytes = tracer
+                               .realloc_multi<cat::byte>(
+                                   slot.p_bytes, slot.size, slot.size * 2u)
+                               .or_exit()
+                               .data();
+            slot.size = slot.size * 2u;
+            continue;
+        }
+        if (slot.p_bytes != nullptr) {
+            tracer.free_multi(slot.p_bytes, slot.size);
+        }
+        slot.p_bytes = tracer.alloc_multi<cat::byte>(size).or_exit().data();
+        slot.size = size;
+    }
+
+    cat::span events =
+        pager.alloc_multi<cat::allocation_event>(trace_capacity).or_exit();
+    cat::idx events_count = 0u;
+    while (true) {
+        cat::maybe event = tracer.pop_event();
+        if (!event.has_value()) {
+            break;
+        }
+        events[events_count] = event.value();
+        ++events_count;
+    }
+
+    for (live_allocation& slot : slots) {
+        if (slot.p_bytes != nullptr) {
+            tracer.free_multi(slot.p_bytes, slot.size);
+        }
+    }
+    return {events.data(), events_count};
+}
+
+auto read_trace(cat::page_allocator& pager, char const* p_path)
+    -> cat::span<cat::allocation_event> {
+    nix::file_descriptor file =
+        nix::sys_open(p_path, nix::open_mode::read_only)
+            .or_exit("No such file or directory!", 2);
+    cat::iword const file_size = nix::sys_fstat(file).or_exit().file_size;
+    cat::iword const events_count =
+        file_size / cat::ssizeof(cat::allocation_event);
+
+    cat::span events =
+        pager.alloc_multi<cat::allocation_event>(events_count).or_exit();
+    _ = nix::sys_read(file, static_cast<char const*>(
+                                static_cast<void const*>(events.data())),
+                      events_count * cat::ssizeof(cat::allocation_event))
+            .or_exit("Failed to read trace!", 3);
+    _ = nix::sys_close(file);
+    return events;
+}
+
+void print_result(cat::page_allocator& pager, cat::string allocator_name,
+                  cat::trace_replay_result const& result) {
+    _ = cat::print(
+        cat::format(pager,
+                    "{}: {} cycles, {} bytes requested at peak, {} bytes "
+                    "allocated at peak, {} failed allocations\n",
+                    allocator_name, result.cycles,
+                    cat::uint8(result.peak_requested_bytes.raw),
+                    cat::uint8(result.peak_allocated_bytes.raw),
+                    cat::uint8(result.failed_allocations.raw))
+            .or_exit());
+}
+
+auto main(int argc, char* p_argv[]) -> int {
+    cat::page_allocator pager;
+    cat::span<cat::allocation_event> events =
+        (argc > 1) ? read_trace(pager, p_argv[1]) : record_workload(pager);
+    cat::span<cat::allocation_event const> const_events(events.data(),
+                                                         events.size());
+
+    cat::page_allocator page_target;
+    print_result(pager, "page_allocator",
+                 cat::replay_trace(page_target, const_events, pager).or_exit());
+
+    cat::slab_allocator slab_target;
+    print_result(pager, "slab_allocator",
+                 cat::replay_trace(slab_target, const_events, pager).or_exit());
+    slab_target.reset();
+}
@@ -0,0 +1,103 @@
+#include <cat/format>
+#include <cat/page_allocator>
+#include <cat/slab_allocator>
+#include <cat/string>
+#include <cat/tlsf_allocator>
+
+// This measures the latency of every single allocation and free of random
+// sizes, and reports the mean and the worst case. A real-time allocator is
+// judged by its worst case, rather than by its throughput.
+
+inline constexpr cat::idx iterations = 200'000u;
+inline constexpr cat::idx live_slots = 1'024u;
+inline constexpr cat::idx max_allocation_bytes = 8_uki;
+
+struct latency {
+    cat::uint8 total_cycles = 0u;
+    cat::uint8 worst_cycles = 0u;
+    cat::uint8 operations = 0u;
+
+    void record(cat::uint8 cycles) {
+        this->total_cycles += cycles;
+        this->worst_cycles = cat::max(this->worst_cycles, cycles);
+        ++this->operations;
+    }
+};
+
+struct latency_result {
+    latency allocations;
+    latency frees;
+};
+
+auto measure(cat::is_allocator auto& allocator) -> latency_result {
+    struct live_allocation {
+        cat::byte* p_bytes = nullptr;
+        cat::idx size = 0u;
+    };
+    live_allocation slots[live_slots.raw];
+    latency_result result;
+
+    // A xorshift generator picks slots and sizes, so that every allocator
+    // sees the same sequence.
+    cat::uint8 state = 0x9e37'79b9'7f4a'7c15u;
+    for (cat::idx i = 0u; i < iterations; ++i) {
+        state ^= state << 13u;
+        state ^= state >> 7u;
+        state ^= state << 17u;
+        live_allocation& slot = slots[state.raw % live_slots.raw];
+
+        if (slot.p_bytes != nullptr) {
+            cat::uint8 const start = __builtin_ia32_rdtsc();
+            allocator.free_multi(slot.p_bytes, slot.size);
+            result.frees.record(__builtin_ia32_rdtsc() - start);
+        }
+
+        cat::idx const size =
+            1u + (state.raw >> 32u) % max_allocation_bytes.raw;
+        cat::uint8 const start = __builtin_ia32_rdtsc();
+        slot.p_bytes = allocator.template alloc_multi<cat::byte>(size)
+                           .or_exit("Allocation failed!")
+                           .data();
+        result.allocations.record(__builtin_ia32_rdtsc() - start);
+        slot.size = size;
+    }
+
+    for (live_allocation& slot : slots) {
+        if (slot.p_bytes != nullptr) {
+            allocator.free_multi(slot.p_bytes, slot.size);
+        }
+    }
+    return result;
+}
+
+void print_result(cat::page_allocator& pager, cat::string allocator_name,
+                  latency_result const& result) {
+    _ = cat::print(
+        cat::format(pager,
+                    "{}:\n    alloc: {} cycles mean, {} cycles worst\n"
+                    "    free: {} cycles mean, {} cycles worst\n",
+                    allocator_name,
+                    result.allocations.total_cycles /
+                        result.allocations.operations,
+                    result.allocations.worst_cycles,
+                    result.frees.total_cycles / result.frees.operations,
+                    result.frees.worst_cycles)
+            .or_exit());
+}
+
+auto main() -> int {
+    cat::page_allocator pager;
+
+    // The arena holds every live slot at its largest size.
+    auto tlsf = cat::tlsf_allocator::backed(
+                    pager, live_slots * max_allocation_bytes * 2u)
+                    .or_exit("Failed to allocate an arena!");
+    print_result(pager, "tlsf_allocator", measure(tlsf));
+
+    cat::slab_allocator slab;
+    print_result(pager, "slab_allocator", measure(slab));
+    slab.reset();
+
+    cat::page_allocator page_target;
+    print_result(pager, "page_allocator", measure(page_target));
+}
@@ -1,10 +1,9 @@
 #include <cat/debug>
 #include <cat/format>
-#include <cat/page_allocator>
+#include <cat/inline_allocator>
 
 void cat::detail::print_assert_location(source_location const& callsite) {
-    page_allocator allocator;
-    // TODO: This will leak. An `inline_allocator` should be used.
+    inline_allocator<256u> allocator;
     _ = eprint(format(allocator, "assert failed on line {}, in:\n    ",
                       callsite.line())
                    .or_exit());
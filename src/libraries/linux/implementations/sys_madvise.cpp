@@ -0,0 +1,8 @@
+#include <cat/linux>
+
+// `nix::sys_madvise()` wraps the `madvise` Linux syscall. This tells the kernel
+// how a range of virtual memory will be used.
+auto nix::sys_madvise(void const* p_memory, cat::uword length,
+                      nix::memory_advice advice) -> nix::scaredy_nix<void> {
+    return nix::syscall<void>(28, p_memory, length, advice);
+}
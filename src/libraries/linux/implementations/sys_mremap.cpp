@@ -0,0 +1,11 @@
+#include <cat/linux>
+
+// `nix::sys_mremap()` wraps the `mremap` Linux syscall. This resizes a mapping
+// of virtual memory, and possibly moves it. This returns the new address of
+// the mapping.
+auto nix::sys_mremap(void const* p_old_memory, cat::uword old_length,
+                     cat::uword new_length, nix::remap_flags flags)
+    -> nix::scaredy_nix<void*> {
+    return nix::syscall<void*>(25, p_old_memory, old_length, new_length,
+                               flags);
+}
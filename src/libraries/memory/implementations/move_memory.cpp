@@ -0,0 +1,53 @@
+#include <cat/memory>
+
+// Copy some bytes from one address to another address, where the two ranges
+// may overlap.
+// `tree-loop-distribute-patterns` could replace these loops with a call to
+// `memmove`, which libCat does not provide.
+[[gnu::optimize("-fno-tree-loop-distribute-patterns")]]
+void cat::move_memory(void const* p_source, void* p_destination, uword bytes) {
+    using chunk_type [[gnu::vector_size(32)]] = unsigned char;
+
+    unsigned char const* p_source_handle =
+        static_cast<unsigned char const*>(p_source);
+    unsigned char* p_destination_handle =
+        static_cast<unsigned char*>(p_destination);
+    uword::raw_type remaining = bytes.raw;
+
+    // If the ranges do not overlap, this is an ordinary copy.
+    if (p_destination_handle >= p_source_handle + remaining ||
+        p_source_handle >= p_destination_handle + remaining) {
+        copy_memory(p_source, p_destination, bytes);
+        return;
+    }
+
+    // Every chunk is loaded before it is stored, so copying forwards is safe
+    // when the destination is below the source, and copying backwards is safe
+    // when it is above.
+    chunk_type chunk;
+    if (p_destination_handle < p_source_handle) {
+        while (remaining >= sizeof(chunk_type)) {
+            __builtin_memcpy(&chunk, p_source_handle, sizeof(chunk_type));
+            __builtin_memcpy(p_destination_handle, &chunk, sizeof(chunk_type));
+            p_source_handle += sizeof(chunk_type);
+            p_destination_handle += sizeof(chunk_type);
+            remaining -= sizeof(chunk_type);
+        }
+        for (uword::raw_type i = 0u; i < remaining; ++i) {
+            p_destination_handle[i] = p_source_handle[i];
+        }
+        return;
+    }
+
+    while (remaining >= sizeof(chunk_type)) {
+        remaining -= sizeof(chunk_type);
+        __builtin_memcpy(&chunk, p_source_handle + remaining,
+                         sizeof(chunk_type));
+        __builtin_memcpy(p_destination_handle + remaining, &chunk,
+                         sizeof(chunk_type));
+    }
+    while (remaining > 0u) {
+        --remaining;
+        p_destination_handle[remaining] = p_source_handle[remaining];
+    }
+}
@@ -0,0 +1,78 @@
+#include <cat/bitmap_allocator>
+#include <cat/page_allocator>
+
+#include "../unit_tests.hpp"
+
+namespace {
+struct particle {
+    int4 x;
+    int4 y;
+};
+}  // namespace
+
+TEST(test_bitmap_allocator) {
+    cat::page_allocator pager;
+    auto allocator = cat::bitmap_allocator<8, 200u>::backed(pager).or_exit();
+
+    // Single slots are taken in address order.
+    particle* p_first = allocator.alloc<particle>().or_exit();
+    particle* p_second = allocator.alloc<particle>().or_exit();
+    cat::verify(p_second == p_first + 1);
+    cat::verify(allocator.owns(p_second));
+
+    // Freeing clears a bit, and the hole is reused first.
+    allocator.free(p_first);
+    cat::verify(!allocator.is_live(0u));
+    particle* p_third = allocator.alloc<particle>().or_exit();
+    cat::verify(p_third == p_first);
+    p_third->x = 3;
+
+    // A run of contiguous slots skips holes which are too small. Free a slot
+    // between two live slots, so that a run of two must start after them.
+    particle* p_fourth = allocator.alloc<particle>().or_exit();
+    particle* p_fifth = allocator.alloc<particle>().or_exit();
+    allocator.free(p_fourth);
+    cat::verify(!allocator.is_live(2u));
+    cat::span pair = allocator.alloc_bulk<particle>(2u).or_exit();
+    cat::verify(pair.data() == p_fifth + 1);
+    // A single slot still fills the hole.
+    cat::verify(allocator.alloc<particle>().or_exit() == p_fourth);
+
+    // Holes which cross words of the bitmap are skipped, too. Slots 0 to 5
+    // are live, so this fills slots 6 to 69, then frees slots 60 to 67.
+    cat::span filler = allocator.alloc_bulk<particle>(64u).or_exit();
+    allocator.free_bulk(cat::span<particle>(filler.data() + 54, 8u));
+    cat::verify(!allocator.is_live(63u) && !allocator.is_live(64u));
+    cat::span long_run = allocator.alloc_bulk<particle>(9u).or_exit();
+    cat::verify(long_run.data() == filler.data() + 64);
+    cat::span short_run = allocator.alloc_bulk<particle>(8u).or_exit();
+    cat::verify(short_run.data() == filler.data() + 54);
+
+    // Start over with only the first slot live.
+    allocator.reset();
+    p_third = allocator.alloc<particle>().or_exit();
+    cat::verify(p_third == p_first);
+    p_third->x = 3;
+    cat::span run = allocator.alloc_bulk<particle>(100u).or_exit();
+    cat::verify(run.data() == p_third + 1);
+    cat::verify(allocator.is_live(100u));
+    cat::verify(!allocator.is_live(101u));
+    cat::verify(!allocator.alloc_bulk<particle>(100u).has_value());
+
+    // Live slots are visited in address order.
+    for (particle& p : run) {
+        p.x = 1;
+    }
+    int4 sum = 0;
+    int live_count = 0;
+    for (particle& p : allocator.live<particle>()) {
+        sum += p.x;
+        ++live_count;
+    }
+    cat::verify(live_count == 101);
+    cat::verify(sum == 103);
+
+    allocator.free_bulk(run);
+    cat::verify(!allocator.is_live(50u));
+    cat::verify(allocator.alloc_bulk<particle>(199u).has_value());
+}
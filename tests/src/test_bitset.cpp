@@ -166,4 +166,30 @@ TEST(test_bitset) {
     for (cat::bit_reference bit : bits127) {
         cat::verify(bit == true);
     }
+
+    // Test `.assign_range()`, `.next_one()`, and `.next_zero()` across storage
+    // elements.
+    cat::bitset<127u> ranges{};
+    cat::verify(!ranges.next_one(0u).has_value());
+    cat::verify(ranges.next_zero(0u).value() == 0u);
+    ranges.assign_range(60u, 10u, true);
+    cat::verify(ranges[60u] && ranges[69u]);
+    cat::verify(!ranges[59u] && !ranges[70u]);
+    cat::verify(ranges.next_one(0u).value() == 60u);
+    cat::verify(ranges.next_one(65u).value() == 65u);
+    cat::verify(ranges.next_zero(60u).value() == 70u);
+    cat::verify(!ranges.next_one(70u).has_value());
+
+    ranges.assign_range(62u, 4u, false);
+    cat::verify(ranges.next_zero(60u).value() == 62u);
+    cat::verify(ranges.next_one(62u).value() == 66u);
+
+    // Bits past the end of a bitset are never found.
+    ranges.assign_range(0u, 127u, true);
+    cat::verify(!ranges.next_zero(0u).has_value());
+
+    cat::bitset<17u> small_ranges{};
+    small_ranges.assign_range(3u, 14u, true);
+    cat::verify(small_ranges.next_one(0u).value() == 3u);
+    cat::verify(!small_ranges.next_zero(3u).has_value());
 }
@@ -0,0 +1,56 @@
+#include <cat/bit>
+#include <cat/buddy_allocator>
+#include <cat/page_allocator>
+
+#include "../unit_tests.hpp"
+
+TEST(test_buddy_allocator) {
+    cat::page_allocator pager;
+    auto buddy = cat::buddy_allocator::backed(pager).or_exit();
+
+    // Allocations are rounded up to a power of two, and blocks are aligned to
+    // their own size.
+    auto buffer = buddy.salloc_multi<cat::byte>(5_uki).or_exit();
+    cat::verify(buffer.second() == 8_uki);
+    cat::verify(cat::is_aligned(buffer.first().data(), 8'192u));
+    cat::verify(buddy.owns(buffer.first().data()));
+
+    // The buddy of a block is split off of the same parent.
+    cat::span first = buddy.alloc_multi<cat::byte>(4_uki).or_exit();
+    cat::span second = buddy.alloc_multi<cat::byte>(4_uki).or_exit();
+    cat::verify(second.data() == first.data() + 4'096);
+    second[4'095] = 1;
+
+    // Freeing every block coalesces the region back into one block, so the
+    // whole region can be allocated again.
+    buddy.free(first);
+    buddy.free(second);
+    buddy.free_multi(buffer.first().data(), 5_uki);
+    cat::span whole = buddy.alloc_multi<cat::byte>(64_umi).or_exit();
+    cat::verify(!buddy.alloc_multi<cat::byte>(4_uki).has_value());
+    buddy.free(whole);
+
+    // Blocks of many sizes do not overlap.
+    int4* p_blocks[16];
+    for (int i = 0; i < 16; ++i) {
+        p_blocks[i] = buddy.alloc_multi<int4>(cat::idx(1'024 << (i % 8)))
+                          .or_exit()
+                          .data();
+        p_blocks[i][0] = i;
+    }
+    for (int i = 0; i < 16; ++i) {
+        cat::verify(p_blocks[i][0] == i);
+    }
+
+    // Over-aligned allocations take a block at least as large as their
+    // alignment.
+    buddy.reset();
+    int4* p_aligned = buddy.align_alloc<int4>(1'048'576u).or_exit();
+    cat::verify(cat::is_aligned(p_aligned, 1'048'576u));
+
+    // Freeing an over-aligned block with its requested size frees the whole
+    // block, so the region coalesces back into one block.
+    buddy.free(p_aligned);
+    whole = buddy.alloc_multi<cat::byte>(64_umi).or_exit();
+    buddy.free(whole);
+}
@@ -0,0 +1,54 @@
+#include <cat/chained_arena>
+#include <cat/math>
+#include <cat/page_allocator>
+#include <cat/utility>
+
+#include "../unit_tests.hpp"
+
+namespace {
+
+// This is default-constructed without initializing its storage, so that
+// allocating it reads whatever the arena's memory already holds.
+struct uninitialized_int {
+    // NOLINTNEXTLINE This must not be `default`ed.
+    uninitialized_int() {
+    }
+
+    int4::raw_type value;
+};
+
+}  // namespace
+
+TEST(test_chained_arena) {
+    cat::page_allocator pager;
+    cat::chained_arena arena(pager, 4_uki);
+    defer(arena.release();)
+
+    // Allocate more than the first block holds, so that the arena grows.
+    int4* p_ints[2'000];
+    for (int i = 0; i < 2'000; ++i) {
+        p_ints[i] = arena.alloc<int4>(i).or_exit();
+    }
+    // Allocations in earlier blocks are not moved by growing.
+    for (int i = 0; i < 2'000; ++i) {
+        cat::verify(*p_ints[i] == i);
+    }
+
+    // Aligned allocations are padded within a block.
+    int4* p_aligned = arena.align_alloc<int4>(256u).or_exit();
+    cat::verify(cat::is_aligned(p_aligned, 256u));
+
+    // An allocation larger than the next block makes a block that fits it.
+    cat::span large_array = arena.alloc_multi<int4>(100'000u).or_exit();
+    large_array[99'999] = 1;
+
+    // Resetting keeps only the largest block, so the same large allocation
+    // fits at its beginning again. The block is reused rather than remapped,
+    // so it still holds what was written to it.
+    arena.reset();
+    cat::span reused_array =
+        arena.alloc_multi<uninitialized_int>(100'000u).or_exit();
+    cat::verify(static_cast<void*>(reused_array.data()) ==
+                static_cast<void*>(large_array.data()));
+    cat::verify(reused_array[99'999].value == 1);
+}
@@ -0,0 +1,124 @@
+#include <cat/checksum>
+#include <cat/page_allocator>
+
+#include "../unit_tests.hpp"
+
+namespace {
+auto as_bytes(char const* p_characters, cat::uword length)
+    -> cat::span<cat::byte const> {
+    return {static_cast<cat::byte const*>(
+                static_cast<void const*>(p_characters)),
+            length};
+}
+
+// These compute each checksum one bit or one word at a time.
+auto reference_crc32c(cat::span<cat::byte const> bytes) -> cat::uint4 {
+    uint4::raw_type crc = 0xffff'ffffu;
+    for (cat::byte value : bytes) {
+        crc ^= value.value;
+        for (int4::raw_type bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1u) ^ ((crc & 1u) != 0u ? 0x82f6'3b78u : 0u);
+        }
+    }
+    return ~crc;
+}
+
+auto reference_adler32(cat::span<cat::byte const> bytes) -> cat::uint4 {
+    uint4::raw_type sum_1 = 1u;
+    uint4::raw_type sum_2 = 0u;
+    for (cat::byte value : bytes) {
+        sum_1 = (sum_1 + value.value) % 65'521u;
+        sum_2 = (sum_2 + sum_1) % 65'521u;
+    }
+    return (sum_2 << 16u) | sum_1;
+}
+
+auto reference_fletcher32(cat::span<cat::byte const> bytes) -> cat::uint4 {
+    uint4::raw_type sum_1 = 0u;
+    uint4::raw_type sum_2 = 0u;
+    for (idx i = 0u; i < bytes.size(); i += 2u) {
+        uint4::raw_type word = bytes[i].value;
+        if (i + 1u < bytes.size()) {
+            word |= uint4::raw_type(bytes[i + 1u].value) << 8u;
+        }
+        sum_1 = (sum_1 + word) % 65'535u;
+        sum_2 = (sum_2 + sum_1) % 65'535u;
+    }
+    return (sum_2 << 16u) | sum_1;
+}
+
+void verify_against_references(cat::span<cat::byte const> bytes) {
+    cat::verify(cat::crc32c(bytes) == reference_crc32c(bytes));
+    cat::verify(cat::adler32(bytes) == reference_adler32(bytes));
+    cat::verify(cat::fletcher32(bytes) == reference_fletcher32(bytes));
+}
+}  // namespace
+
+TEST(test_checksum) {
+    // Test well-known check values.
+    cat::verify(cat::crc32c(as_bytes("123456789", 9u)) == 0xe306'9283u);
+    cat::verify(cat::adler32(as_bytes("Wikipedia", 9u)) == 0x11e6'0398u);
+    cat::verify(cat::fletcher32(as_bytes("abcde", 5u)) == 0xf04f'c729u);
+    cat::verify(cat::fletcher32(as_bytes("abcdef", 6u)) == 0x5650'2d2au);
+    cat::verify(cat::fletcher32(as_bytes("abcdefgh", 8u)) == 0xebe1'9591u);
+    cat::verify(cat::crc32c(as_bytes("", 0u)) == 0u);
+    cat::verify(cat::adler32(as_bytes("", 0u)) == 1u);
+
+    // The buffer is long enough for three interleaved CRC blocks of each
+    // size, and several Adler-32 and Fletcher-32 blocks.
+    constexpr cat::idx buffer_bytes = 30'000u;
+    cat::page_allocator pager;
+    cat::span<cat::byte> buffer =
+        pager.alloc_multi<cat::byte>(buffer_bytes).verify();
+    defer(pager.free_multi(buffer.data(), buffer.size());)
+    for (idx i = 0u; i < buffer_bytes; ++i) {
+        buffer[i] = static_cast<unsigned char>((i.raw * 167u) ^ (i.raw >> 5u));
+    }
+
+    // Test every short length, and lengths around each block size.
+    for (idx length = 0u; length <= 100u; ++length) {
+        verify_against_references({buffer.data(), length});
+    }
+    constexpr cat::idx lengths[] = {767u,    768u,    769u,    4'096u,
+                                    4'099u,  5'536u,  5'600u,  24'576u,
+                                    25'353u, 30'000u};
+    for (cat::idx length : lengths) {
+        verify_against_references({buffer.data(), length});
+    }
+
+    // Bytes of all ones give the largest intermediate sums.
+    cat::set_memory(buffer.data(), static_cast<unsigned char>(0xff),
+                    buffer_bytes);
+    verify_against_references({buffer.data(), buffer_bytes});
+    verify_against_references({buffer.data(), 12'291u});
+    for (idx i = 0u; i < buffer_bytes; ++i) {
+        buffer[i] = static_cast<unsigned char>((i.raw * 167u) ^ (i.raw >> 5u));
+    }
+
+    // Streaming the input in pieces produces the same checksum, including
+    // pieces that split Fletcher-32's words.
+    constexpr cat::idx splits[] = {0u, 1u, 7u, 1'000u, 25'001u, 30'000u};
+    cat::crc32c_stream crc;
+    cat::adler32_stream adler;
+    cat::fletcher32_stream fletcher;
+    for (idx::raw_type split = 0u; split + 1u < 6u; ++split) {
+        cat::span<cat::byte const> const piece = {
+            buffer.data() + splits[split].raw,
+            splits[split + 1u] - splits[split]};
+        crc.update(piece);
+        adler.update(piece);
+        fletcher.update(piece);
+    }
+    cat::span<cat::byte const> const whole = buffer;
+    cat::verify(crc.value() == cat::crc32c(whole));
+    cat::verify(adler.value() == cat::adler32(whole));
+    cat::verify(fletcher.value() == cat::fletcher32(whole));
+
+    // An odd byte is padded when the value is read, but the stream can still
+    // be continued.
+    cat::fletcher32_stream letters;
+    letters.update(as_bytes("abc", 3u));
+    cat::verify(letters.value() == cat::fletcher32(as_bytes("abc", 3u)));
+    letters.update(as_bytes("def", 3u));
+    cat::verify(letters.value() == 0x5650'2d2au);
+}
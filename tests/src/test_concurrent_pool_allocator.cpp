@@ -0,0 +1,98 @@
+#include <cat/atomic>
+#include <cat/concurrent_pool_allocator>
+#include <cat/page_allocator>
+#include <cat/runtime>
+#include <cat/thread>
+
+#include "../unit_tests.hpp"
+
+namespace {
+
+constexpr int4 pool_threads_count = 4;
+constexpr int4 pool_iterations = 10'000;
+constexpr int4 pool_nodes_count = 64;
+
+struct pool_stress_arguments {
+    cat::concurrent_pool_allocator<8>* p_pool;
+    cat::atomic<int4::raw_type> finished_threads = 0;
+    cat::atomic<int4::raw_type> next_thread_id = 0;
+};
+
+void pool_stress(void* p_arguments) {
+    pool_stress_arguments& arguments =
+        *static_cast<pool_stress_arguments*>(p_arguments);
+    int4 const thread_id = arguments.next_thread_id.fetch_add(1) + 1;
+
+    for (int4 i = 0; i < pool_iterations; ++i) {
+        // Hold two nodes at once, to interleave pushes and pops between
+        // threads.
+        cat::maybe maybe_1 = arguments.p_pool->alloc<int4>(thread_id);
+        cat::maybe maybe_2 = arguments.p_pool->alloc<int4>(thread_id);
+
+        // If another thread was handed the same node, it would overwrite this
+        // thread's id.
+        if (maybe_1.has_value()) {
+            cat::verify(*maybe_1.value() == thread_id);
+        }
+        if (maybe_2.has_value()) {
+            cat::verify(*maybe_2.value() == thread_id);
+            arguments.p_pool->free(maybe_2.value());
+        }
+        if (maybe_1.has_value()) {
+            arguments.p_pool->free(maybe_1.value());
+        }
+    }
+
+    _ = arguments.finished_threads.fetch_add(1, cat::memory_order::release);
+    cat::exit();
+}
+
+}  // namespace
+
+TEST(test_concurrent_pool_allocator) {
+    // Initialize an allocator.
+    cat::page_allocator pager;
+    cat::maybe maybe_pool = cat::concurrent_pool_allocator<8>::backed(
+        pager, pool_nodes_count * 8);
+    cat::concurrent_pool_allocator<8>& pool = maybe_pool.verify();
+
+    // Make an allocation.
+    int4* p_int1 = pool.alloc<int4>(10).verify();
+    cat::verify(*p_int1 == 10);
+
+    // A freed node is recycled by the next allocation.
+    pool.free(p_int1);
+    int4* p_int2 = pool.alloc<int4>(20).verify();
+    cat::verify(p_int2 == p_int1);
+    pool.free(p_int2);
+
+    // Share the pool between several threads.
+    pool_stress_arguments arguments;
+    arguments.p_pool = &pool;
+
+    cat::thread threads[pool_threads_count.raw];
+    for (cat::thread& thread : threads) {
+        thread.create(pager, 64_uki, pool_stress, &arguments)
+            .or_exit("Failed to make thread!");
+    }
+    for (cat::thread& thread : threads) {
+        thread.join().or_exit("Failed to join thread!");
+    }
+
+    // Wait until every thread has finished its iterations.
+    while (arguments.finished_threads.load(cat::memory_order::acquire) <
+           pool_threads_count) {
+        cat::relax_cpu();
+    }
+
+    // Every node must have been returned to the free list exactly once.
+    for (int4 i = 0; i < pool_nodes_count; ++i) {
+        _ = pool.alloc<int4>().verify();
+    }
+    cat::verify(!pool.alloc<int4>().has_value());
+
+    // A pool without any nodes can be reset, and it never allocates.
+    cat::concurrent_pool_allocator<8> empty_pool;
+    empty_pool.reset();
+    cat::verify(!empty_pool.alloc<int4>().has_value());
+}
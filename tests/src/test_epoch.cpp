@@ -0,0 +1,114 @@
+#include <cat/atomic>
+#include <cat/epoch>
+#include <cat/page_allocator>
+#include <cat/runtime>
+#include <cat/thread>
+
+#include "../unit_tests.hpp"
+
+namespace {
+int4 nodes_destroyed = 0;
+
+struct epoch_test_node {
+    int4 value;
+
+    ~epoch_test_node() {
+        ++nodes_destroyed;
+    }
+};
+
+struct epoch_reader_arguments {
+    cat::epoch_domain* p_domain;
+    cat::atomic<bool> is_pinned = false;
+    cat::atomic<bool> may_unpin = false;
+    cat::atomic<bool> is_unpinned = false;
+};
+
+// Pin an epoch on another thread, and hold it until the main thread allows
+// this to unpin.
+void epoch_read(void* p_arguments) {
+    epoch_reader_arguments& arguments =
+        *static_cast<epoch_reader_arguments*>(p_arguments);
+    {
+        cat::page_allocator pager;
+        cat::epoch_participant reader(*arguments.p_domain, pager);
+        reader.pin();
+        arguments.is_pinned.store(true, cat::memory_order::release);
+        while (!arguments.may_unpin.load(cat::memory_order::acquire)) {
+            cat::relax_cpu();
+        }
+        reader.unpin();
+        arguments.is_unpinned.store(true, cat::memory_order::release);
+    }
+    cat::exit();
+}
+}  // namespace
+
+TEST(test_epoch) {
+    cat::page_allocator pager;
+    cat::epoch_domain domain;
+    cat::epoch_participant writer(domain, pager);
+    cat::epoch_participant reader(domain, pager);
+
+    epoch_test_node* p_node = pager.alloc<epoch_test_node>().or_exit();
+
+    // A node retired while another thread is pinned is not freed until that
+    // thread unpins and the epoch advances twice.
+    reader.pin();
+    writer.retire(pager, p_node).or_exit();
+    writer.collect();
+    writer.collect();
+    cat::verify(nodes_destroyed == 0);
+    cat::verify(domain.epoch() == 1u);
+
+    reader.unpin();
+    writer.collect();
+    cat::verify(domain.epoch() == 2u);
+    cat::verify(nodes_destroyed == 1);
+
+    // Pins nest, and a `pin_scope` unpins when it is destroyed.
+    {
+        auto scope = reader.pinned();
+        reader.pin();
+        reader.unpin();
+        cat::verify(reader.is_pinned());
+    }
+    cat::verify(!reader.is_pinned());
+
+    // Flushing frees every retired node once no thread is pinned.
+    for (int i = 0; i < 10; ++i) {
+        writer.retire(pager, pager.alloc<epoch_test_node>().or_exit())
+            .or_exit();
+    }
+    writer.flush();
+    cat::verify(nodes_destroyed == 11);
+
+    // A reader pinned on another thread blocks reclamation. The node is only
+    // freed after that thread unpins and the epoch moves past its retirement.
+    epoch_reader_arguments arguments;
+    arguments.p_domain = &domain;
+    cat::thread reader_thread;
+    reader_thread.create(pager, 64_uki, epoch_read, &arguments)
+        .or_exit("Failed to make thread!");
+    while (!arguments.is_pinned.load(cat::memory_order::acquire)) {
+        cat::relax_cpu();
+    }
+
+    cat::uint8 const pinned_epoch = domain.epoch();
+    writer.retire(pager, pager.alloc<epoch_test_node>().or_exit()).or_exit();
+    writer.collect();
+    writer.collect();
+    writer.collect();
+    cat::verify(nodes_destroyed == 11);
+    cat::verify(domain.epoch() == pinned_epoch + 1u);
+
+    arguments.may_unpin.store(true, cat::memory_order::release);
+    while (!arguments.is_unpinned.load(cat::memory_order::acquire)) {
+        cat::relax_cpu();
+    }
+    writer.collect();
+    cat::verify(domain.epoch() == pinned_epoch + 2u);
+    cat::verify(nodes_destroyed == 12);
+
+    reader_thread.join().or_exit("Failed to join thread!");
+}
@@ -0,0 +1,27 @@
+#include <cat/fallback_allocator>
+#include <cat/inline_allocator>
+#include <cat/page_allocator>
+
+#include "../unit_tests.hpp"
+
+TEST(test_fallback_allocator) {
+    cat::fallback_allocator<cat::inline_allocator<64u>, cat::page_allocator>
+        allocator;
+    static_assert(decltype(allocator)::has_pointer_stability);
+
+    // This fits in the primary allocator.
+    cat::span small_array = allocator.alloc_multi<int4>(8u).or_exit();
+    cat::verify(allocator.primary.owns(small_array.data()));
+
+    // This does not fit in the primary allocator, so it falls back to pages.
+    cat::span large_array = allocator.alloc_multi<int4>(1'000u).or_exit();
+    cat::verify(!allocator.primary.owns(large_array.data()));
+    large_array[999] = 1;
+    cat::verify(large_array[0] == 0);
+
+    // Memory is freed to whichever allocator it came from.
+    allocator.free(large_array);
+    allocator.free(small_array);
+    cat::span reused_array = allocator.alloc_multi<int4>(8u).or_exit();
+    cat::verify(reused_array.data() == small_array.data());
+}
@@ -0,0 +1,106 @@
+#include <cat/hash>
+#include <cat/string>
+
+#include "../unit_tests.hpp"
+
+namespace {
+struct hash_point {
+    int4 x;
+    int4 y;
+};
+
+enum class hash_color : uint1::raw_type {
+    red,
+    green,
+};
+}  // namespace
+
+TEST(test_hash) {
+    // Fill a buffer with bytes that do not repeat with a short period.
+    cat::byte buffer[600];
+    for (cat::uword::raw_type i = 0u; i < 600u; ++i) {
+        buffer[i] = static_cast<unsigned char>((i * 131u) ^ (i >> 3u));
+    }
+
+    // Test that hashes are deterministic and depend on their seed.
+    cat::span<cat::byte const> const bytes(buffer, 100u);
+    cat::verify(cat::rapidhash(bytes) == cat::rapidhash(bytes));
+    cat::verify(cat::rapidhash(bytes, 1u) != cat::rapidhash(bytes, 2u));
+    cat::span<cat::byte const> const bulk_bytes(buffer, 600u);
+    cat::verify(cat::aes_hash(bulk_bytes) == cat::aes_hash(bulk_bytes));
+    cat::verify(cat::aes_hash(bulk_bytes, 1u) !=
+                cat::aes_hash(bulk_bytes, 2u));
+
+    // Every prefix of the buffer hashes differently, including across the
+    // boundaries between `rapidhash()`'s paths and the switch to
+    // `aes_hash()`.
+    cat::uint8 previous =
+        cat::hash_bytes(cat::span<cat::byte const>(buffer, 0u));
+    for (cat::uword length = 1u; length <= 600u; ++length) {
+        cat::uint8 const current =
+            cat::hash_bytes(cat::span<cat::byte const>(buffer, length));
+        cat::verify(current != previous);
+        previous = current;
+    }
+
+    // Changing any one byte changes the hash, for both hashes.
+    cat::uint8 const small_hash = cat::rapidhash(bytes);
+    cat::uint8 const bulk_hash = cat::aes_hash(bulk_bytes);
+    for (cat::uword::raw_type i = 0u; i < 600u; ++i) {
+        buffer[i] = static_cast<unsigned char>(buffer[i].value ^ 1u);
+        if (i < 100u) {
+            cat::verify(cat::rapidhash(bytes) != small_hash);
+        }
+        cat::verify(cat::aes_hash(bulk_bytes) != bulk_hash);
+        buffer[i] = static_cast<unsigned char>(buffer[i].value ^ 1u);
+    }
+
+    // Swapping two 16-byte blocks in different lanes changes the bulk hash.
+    cat::byte swapped[600];
+    cat::copy_memory(buffer, swapped, 600u);
+    cat::copy_memory(buffer + 16, swapped, 16u);
+    cat::copy_memory(buffer, swapped + 16, 16u);
+    cat::verify(cat::aes_hash(cat::span<cat::byte const>(swapped, 600u)) !=
+                bulk_hash);
+
+    // Test the integer mixers.
+    cat::verify(cat::mix_integer(1u) != cat::mix_integer(2u));
+    cat::verify(cat::hash_integer(int4(1)) == cat::hash_integer(int4(1)));
+    cat::verify(cat::hash_integer(int4(1)) != cat::hash_integer(int4(2)));
+    cat::verify(cat::hash_integer(int4(1), 1u) !=
+                cat::hash_integer(int4(1), 2u));
+    // Nearby integers differ in about half of their hash bits.
+    cat::uint8 const mixed_bits =
+        cat::hash_integer(idx(10u)) ^ cat::hash_integer(idx(11u));
+    cat::verify(__builtin_popcountll(mixed_bits.raw) >= 16);
+
+    // Test `hash<T>`.
+    cat::hash<int4> const int_hash{};
+    cat::verify(int_hash(5) == cat::hash_integer(int4(5)));
+    cat::hash<hash_color> const color_hash{};
+    cat::verify(color_hash(hash_color::red) != color_hash(hash_color::green));
+    int4 pointee_1 = 0;
+    int4 pointee_2 = 0;
+    cat::hash<int4*> const pointer_hash{};
+    cat::verify(pointer_hash(&pointee_1) != pointer_hash(&pointee_2));
+
+    // Every string-like type hashes the same as a `string`. Both of these
+    // include the null terminator.
+    cat::string const name = "libCat";
+    char name_characters[] = "libCat";
+    cat::span<char> const name_span(name_characters, sizeof(name_characters));
+    cat::verify(cat::hash<cat::string>{}(name) == cat::hash_string(name));
+    cat::verify(cat::default_hash{}(name) == cat::default_hash{}(name_span));
+    cat::verify(cat::default_hash{}(name) !=
+                cat::default_hash{}(cat::string("libcat")));
+
+    // Trivial types are hashed as their bytes.
+    hash_point const point = {1, 2};
+    cat::hash<hash_point> const point_hash{};
+    cat::verify(point_hash(point) ==
+                cat::hash_bytes(cat::span<cat::byte const>(
+                    static_cast<cat::byte const*>(
+                        static_cast<void const*>(&point)),
+                    sizeof(hash_point))));
+    cat::verify(point_hash(point) != point_hash(hash_point{2, 1}));
+}
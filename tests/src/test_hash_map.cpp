@@ -0,0 +1,111 @@
+#include <cat/hash_map>
+#include <cat/page_allocator>
+#include <cat/string>
+
+#include "../unit_tests.hpp"
+
+TEST(test_hash_map) {
+    cat::page_allocator pager;
+
+    // Test an empty map.
+    cat::hash_map<int4, int4> map;
+    defer(map.free(pager);)
+    cat::verify(map.is_empty());
+    cat::verify(!map.find(1).has_value());
+    cat::verify(!map.erase(1));
+
+    // Test inserting and finding entries.
+    cat::verify(map.insert(pager, 1, 10).verify() == 10);
+    cat::verify(map.insert(pager, 2, 20).verify() == 20);
+    cat::verify(map.size() == 2u);
+    cat::verify(map.find(1).verify() == 10);
+    cat::verify(map.find(2).verify() == 20);
+    cat::verify(!map.contains(3));
+
+    // Inserting a key again replaces its value.
+    _ = map.insert(pager, 1, 11).verify();
+    cat::verify(map.size() == 2u);
+    cat::verify(map.find(1).verify() == 11);
+
+    // Values can be modified through `.find()`.
+    map.find(2).value() = 21;
+    cat::verify(map.find(2).verify() == 21);
+
+    // Test growing across many groups.
+    for (int4 i = 0; i < 1'000; ++i) {
+        _ = map.insert(pager, i, i * 2).verify();
+    }
+    cat::verify(map.size() == 1'000u);
+    cat::verify(map.capacity() >= 1'024u);
+    for (int4 i = 0; i < 1'000; ++i) {
+        cat::verify(map.find(i).verify() == i * 2);
+    }
+    cat::verify(!map.contains(1'000));
+    cat::verify(!map.contains(-1));
+
+    // Test erasing entries. Probes continue past the deleted slots.
+    for (int4 i = 0; i < 1'000; i += 2) {
+        cat::verify(map.erase(i));
+    }
+    cat::verify(map.size() == 500u);
+    for (int4 i = 0; i < 1'000; ++i) {
+        cat::verify(map.contains(i) == (i % 2 == 1));
+    }
+
+    // Re-filling erased slots reuses them rather than growing forever.
+    cat::idx const capacity = map.capacity();
+    for (int4 i = 1'000; i < 10'000; ++i) {
+        _ = map.insert(pager, i, i).verify();
+        cat::verify(map.erase(i));
+    }
+    cat::verify(map.capacity() == capacity);
+    cat::verify(map.size() == 500u);
+
+    // Test clearing a map.
+    map.clear();
+    cat::verify(map.is_empty());
+    cat::verify(!map.contains(1));
+    cat::verify(map.capacity() == capacity);
+
+    // Reserving storage prevents rehashing while inserting.
+    cat::hash_map<int4, int4> reserved_map;
+    defer(reserved_map.free(pager);)
+    reserved_map.reserve(pager, 500u).or_exit();
+    cat::idx const reserved_capacity = reserved_map.capacity();
+    cat::verify(reserved_capacity >= 500u);
+    for (int4 i = 0; i < 500; ++i) {
+        _ = reserved_map.insert(pager, i, i).verify();
+    }
+    cat::verify(reserved_map.capacity() == reserved_capacity);
+
+    // Test heterogeneous lookup of `string` keys.
+    cat::hash_map<cat::string, int4> words;
+    defer(words.free(pager);)
+    _ = words.insert(pager, "apple", 1).verify();
+    _ = words.insert(pager, "banana", 2).verify();
+
+    char buffer[6] = {'a', 'p', 'p', 'l', 'e', '\0'};
+    cat::span<char> const apple(buffer, 6u);
+    cat::verify(words.find(apple).verify() == 1);
+    cat::verify(words.find("banana").verify() == 2);
+    cat::verify(!words.contains("cherry"));
+    cat::verify(words.erase(apple));
+    cat::verify(!words.contains("apple"));
+
+    // A C string is found by its characters, not by its address. A literal's
+    // null terminator is not part of its key.
+    _ = words.insert(pager, "cherry", 3).verify();
+    char cherry_buffer[7] = {'c', 'h', 'e', 'r', 'r', 'y', '\0'};
+    char const* p_cherry = cherry_buffer;
+    cat::verify(words.find(p_cherry).verify() == 3);
+    cat::verify(words.erase(p_cherry));
+    cat::verify(!words.contains(cat::string("cherry", 6u)));
+    _ = words.insert(pager, cat::string("date", 4u), 4).verify();
+    cat::verify(words.find("date").verify() == 4);
+
+    // Moving a map takes its table.
+    cat::hash_map<cat::string, int4> moved_words = cat::move(words);
+    defer(moved_words.free(pager);)
+    cat::verify(words.is_empty());
+    cat::verify(moved_words.find("banana").verify() == 2);
+}
@@ -0,0 +1,40 @@
+#include <cat/huge_page_allocator>
+#include <cat/page_allocator>
+
+#include "../unit_tests.hpp"
+
+TEST(test_huge_page_allocator) {
+    // Initialize an allocator. This succeeds whether or not the system has
+    // reserved explicit huge pages.
+    cat::huge_page_allocator allocator;
+
+    // Allocations are rounded up to whole huge pages.
+    cat::verify(allocator.nalloc_multi<cat::byte>(1u).value() == 2_umi);
+    cat::verify(allocator.nalloc_multi<cat::byte>(3_umi).value() == 4_umi);
+
+    // Allocate a huge page.
+    cat::span memory = allocator.alloc_multi<cat::byte>(3_umi).verify();
+    cat::verify(cat::is_aligned(memory.data(), 2_umi));
+    memory[0] = cat::byte(1);
+    memory[3_umi - 1u] = cat::byte(1);
+    allocator.free(memory);
+
+    // Huge pages can be aligned by more than their own size.
+    cat::span aligned =
+        allocator.align_alloc_multi<cat::byte>(8_umi, 1_umi).verify();
+    cat::verify(cat::is_aligned(aligned.data(), 8_umi));
+    aligned[0] = cat::byte(1);
+    allocator.free(aligned);
+
+    // Normal pages can also be aligned by more than their own size.
+    cat::page_allocator pager;
+    cat::span page_aligned =
+        pager.align_alloc_multi<cat::byte>(64_uki, 5_uki).verify();
+    cat::verify(cat::is_aligned(page_aligned.data(), 64_uki));
+    page_aligned[5_uki - 1u] = cat::byte(1);
+    pager.free(page_aligned);
+
+    // Page allocations report their size exactly.
+    cat::verify(pager.nalloc_multi<cat::byte>(4_uki).value() == 4_uki);
+    cat::verify(pager.nalloc_multi<cat::byte>(4_uki + 1u).value() == 8_uki);
+}
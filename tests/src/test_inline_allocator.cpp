@@ -0,0 +1,69 @@
+#include <cat/inline_allocator>
+#include <cat/math>
+#include <cat/vector>
+
+#include "../unit_tests.hpp"
+
+TEST(test_inline_allocator) {
+    cat::inline_allocator<64u> allocator;
+
+    // Allocations are stored inside of the allocator.
+    int4* p_int = allocator.alloc<int4>(1).or_exit();
+    cat::verify(cat::uintptr<void>(p_int) >=
+                cat::uintptr<void>(cat::addressof(allocator)));
+    cat::verify(cat::uintptr<void>(p_int) <
+                cat::uintptr<void>(cat::addressof(allocator) + 1));
+
+    // Freeing the most recent allocation pops it off.
+    allocator.free(p_int);
+    int4* p_int_2 = allocator.alloc<int4>(2).or_exit();
+    cat::verify(p_int_2 == p_int);
+
+    // Aligned allocations are padded.
+    int8* p_aligned = allocator.align_alloc<int8>(16u).or_exit();
+    cat::verify(cat::is_aligned(p_aligned, 16u));
+
+    // The most recent allocation grows in place.
+    cat::span array = allocator.alloc_multi<int4>(2u).or_exit();
+    array[1] = 10;
+    cat::span grown_array =
+        allocator.realloc_multi<int4>(array.data(), 2u, 6u).or_exit();
+    cat::verify(grown_array.data() == array.data());
+    cat::verify(grown_array[1] == 10);
+    cat::verify(grown_array[5] == 0);
+
+    // The arena is exhausted.
+    cat::verify(!allocator.alloc_multi<int4>(8u).has_value());
+
+    allocator.reset();
+    cat::verify(allocator.alloc_multi<int4>(16u).has_value());
+}
+
+TEST(test_inline_allocator_vector) {
+    cat::inline_allocator<64u> allocator;
+
+    // Size feedback does not count alignment padding.
+    _ = allocator.alloc<byte>().or_exit();
+    auto [aligned, aligned_bytes] =
+        allocator.align_salloc_multi<byte>(16u, 8u).or_exit();
+    cat::verify(cat::is_aligned(aligned.data(), 16u));
+    cat::verify(aligned_bytes == 8u);
+    allocator.reset();
+
+    // A `vector` grows in place through the whole arena. Its capacity must
+    // not be lost once the arena is more than half full.
+    cat::vector<int4> vector;
+    for (int4 i = 0; i < 16; ++i) {
+        vector.push_back(allocator, i).or_exit();
+    }
+    cat::verify(vector.size() == 16u);
+    cat::verify(vector.capacity() == 16u);
+    int4 expected = 0;
+    for (int4 element : vector) {
+        cat::verify(element == expected);
+        ++expected;
+    }
+
+    // The arena is exhausted.
+    cat::verify(!vector.push_back(allocator, 16).has_value());
+}
@@ -0,0 +1,48 @@
+#include <cat/linear_allocator>
+#include <cat/page_allocator>
+
+#include "../unit_tests.hpp"
+
+TEST(test_linear_allocator_rewind) {
+    // Initialize an arena which holds 6 `int4`s.
+    cat::page_allocator pager;
+    auto allocator = cat::linear_allocator::backed(pager, 24u).or_exit();
+
+    _ = allocator.alloc<int4>().or_exit();
+    cat::linear_allocator::save_point outer_point = allocator.save();
+    int4* p_outer = allocator.alloc<int4>(1).or_exit();
+    {
+        auto scratch = allocator.scope();
+        // This arena bumps downwards.
+        int4* p_inner = allocator.alloc<int4>().or_exit();
+        cat::verify(p_inner < p_outer);
+        // 12 bytes are allocated, so 3 more `int4`s fit.
+        _ = allocator.alloc_multi<int4>(3u).or_exit();
+        cat::verify(!allocator.alloc<int4>().has_value());
+    }
+
+    // The scope rewound the inner allocations, so their memory is reused, but
+    // the outer allocation is untouched.
+    int4* p_reused = allocator.alloc<int4>().or_exit();
+    cat::verify(p_reused == p_outer - 1);
+    cat::verify(*p_outer == 1);
+
+    // Scopes nest, and each rewinds only its own allocations.
+    {
+        auto outer_scratch = allocator.scope();
+        int4* p_first = allocator.alloc<int4>().or_exit();
+        {
+            auto inner_scratch = allocator.scope();
+            _ = allocator.alloc_multi<int4>(2u).or_exit();
+            cat::verify(!allocator.alloc<int4>().has_value());
+        }
+        cat::verify(allocator.alloc<int4>().or_exit() == p_first - 1);
+    }
+    cat::verify(allocator.alloc<int4>().or_exit() == p_reused - 1);
+
+    // Rewinding to an earlier save point discards everything after it.
+    allocator.rewind(outer_point);
+    cat::verify(allocator.alloc<int4>().or_exit() == p_outer);
+    allocator.reset();
+    cat::verify(allocator.alloc_multi<int4>(6u).has_value());
+}
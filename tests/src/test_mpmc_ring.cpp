@@ -0,0 +1,130 @@
+#include <cat/atomic>
+#include <cat/mpmc_ring>
+#include <cat/page_allocator>
+#include <cat/runtime>
+#include <cat/thread>
+
+#include "../unit_tests.hpp"
+
+namespace {
+
+constexpr int4 mpmc_threads_count = 4;
+constexpr int4 mpmc_elements_per_producer = 20'000;
+
+struct mpmc_stress_arguments {
+    cat::mpmc_ring<int8>* p_ring;
+    cat::atomic<int4::raw_type> next_producer_id = 0;
+    cat::atomic<int8::raw_type> consumed_count = 0;
+    cat::atomic<int8::raw_type> consumed_sum = 0;
+    cat::atomic<int4::raw_type> finished_threads = 0;
+};
+
+void mpmc_produce(void* p_arguments) {
+    mpmc_stress_arguments& arguments =
+        *static_cast<mpmc_stress_arguments*>(p_arguments);
+    int8 const first_value =
+        int8(arguments.next_producer_id.fetch_add(1)) *
+        int8(mpmc_elements_per_producer.raw);
+
+    for (int4 i = 0; i < mpmc_elements_per_producer; ++i) {
+        while (!arguments.p_ring->push(first_value + int8(i.raw))) {
+            cat::relax_cpu();
+        }
+    }
+
+    _ = arguments.finished_threads.fetch_add(1, cat::memory_order::release);
+    cat::exit();
+}
+
+void mpmc_consume(void* p_arguments) {
+    mpmc_stress_arguments& arguments =
+        *static_cast<mpmc_stress_arguments*>(p_arguments);
+    int8::raw_type const total_count =
+        int8::raw_type(mpmc_threads_count.raw) *
+        mpmc_elements_per_producer.raw;
+
+    // Consume until every element has been taken by some consumer.
+    int8::raw_type count = 0;
+    int8::raw_type sum = 0;
+    while (arguments.consumed_count.load(cat::memory_order::relaxed) <
+           total_count) {
+        cat::maybe value = arguments.p_ring->pop();
+        if (!value.has_value()) {
+            cat::relax_cpu();
+            continue;
+        }
+        ++count;
+        sum += value.value().raw;
+        _ = arguments.consumed_count.fetch_add(1, cat::memory_order::relaxed);
+    }
+
+    _ = arguments.consumed_sum.fetch_add(sum, cat::memory_order::relaxed);
+    _ = arguments.finished_threads.fetch_add(1, cat::memory_order::release);
+    cat::exit();
+}
+
+}  // namespace
+
+TEST(test_mpmc_ring) {
+    cat::page_allocator pager;
+
+    // Test pushing and popping on one thread.
+    cat::mpmc_ring<int8> ring;
+    defer(ring.free(pager);)
+    cat::verify(ring.capacity() == 0u);
+    ring.reserve(pager, 4u).or_exit();
+    cat::verify(ring.capacity() == 4u);
+    cat::verify(ring.is_empty());
+    cat::verify(!ring.pop().has_value());
+
+    cat::verify(ring.push(1));
+    cat::verify(ring.push(2));
+    cat::verify(ring.emplace(3));
+    cat::verify(ring.push(4));
+    cat::verify(ring.size() == 4u);
+    cat::verify(!ring.push(5));
+    cat::verify(ring.pop().verify() == 1);
+    cat::verify(ring.pop().verify() == 2);
+
+    // Slots are reused on the next lap around the storage.
+    cat::verify(ring.push(5));
+    cat::verify(ring.push(6));
+    cat::verify(!ring.push(7));
+    for (int8 expected = 3; expected <= 6; ++expected) {
+        cat::verify(ring.pop().verify() == expected);
+    }
+    cat::verify(!ring.pop().has_value());
+    ring.free(pager);
+
+    // Share the ring between several producers and consumers. Every element
+    // must be consumed exactly once.
+    ring.reserve(pager, 256u).or_exit();
+    mpmc_stress_arguments arguments;
+    arguments.p_ring = &ring;
+
+    cat::thread threads[mpmc_threads_count.raw * 2];
+    for (int4 i = 0; i < mpmc_threads_count; ++i) {
+        threads[i.raw * 2]
+            .create(pager, 64_uki, mpmc_produce, &arguments)
+            .or_exit("Failed to make thread!");
+        threads[i.raw * 2 + 1]
+            .create(pager, 64_uki, mpmc_consume, &arguments)
+            .or_exit("Failed to make thread!");
+    }
+    for (cat::thread& thread : threads) {
+        thread.join().or_exit("Failed to join thread!");
+    }
+    while (arguments.finished_threads.load(cat::memory_order::acquire) <
+           mpmc_threads_count * 2) {
+        cat::relax_cpu();
+    }
+
+    // The elements are `0` through `n - 1`, so their sum is `n(n - 1) / 2`.
+    int8::raw_type const total_count =
+        int8::raw_type(mpmc_threads_count.raw) *
+        mpmc_elements_per_producer.raw;
+    cat::verify(arguments.consumed_count.load() == total_count);
+    cat::verify(arguments.consumed_sum.load() ==
+                total_count * (total_count - 1) / 2);
+    cat::verify(ring.is_empty());
+}
@@ -93,4 +93,32 @@ TEST(test_paging_memory) {
     aligned_mem[0] = 10;
     cat::verify(aligned_mem[0] == 10);
     allocator.free(aligned_mem);
+
+    // Reallocations remap pages rather than copying them.
+    cat::span small_array = allocator.alloc_multi<int4>(1'000u).or_exit();
+    small_array[999] = 10;
+    auto [large_array, large_bytes] =
+        allocator.resalloc_multi<int4>(small_array.data(), 1'000u, 100'000u)
+            .or_exit();
+    cat::verify(large_array.size() == 100'000);
+    // 400,000 bytes are rounded up to 98 pages.
+    cat::verify(large_bytes == 98u * 4_uki);
+    cat::verify(large_array[999] == 10);
+    cat::verify(large_array[99'999] == 0);
+    allocator.free(large_array);
+
+    // Unmap all but the first page of an array, so that the pages after it
+    // are free. Only a remap can grow it in place, because a copy would be
+    // allocated while the first page is still mapped.
+    cat::span remapped_array =
+        allocator.alloc_multi<int4>(98u * 1'024u).or_exit();
+    int4* p_first_page = remapped_array.data();
+    p_first_page[1'023] = 20;
+    allocator.free_multi(p_first_page + 1'024, 97u * 1'024u);
+    remapped_array =
+        allocator.realloc_multi<int4>(p_first_page, 1'024u, 98u * 1'024u)
+            .or_exit();
+    cat::verify(remapped_array.data() == p_first_page);
+    cat::verify(remapped_array[1'023] == 20);
+    allocator.free(remapped_array);
 };
@@ -0,0 +1,41 @@
+#include <cat/page_allocator>
+#include <cat/pool_allocator>
+
+#include "../unit_tests.hpp"
+
+TEST(test_pool_allocator_reset) {
+    // Initialize a pool of 256 nodes.
+    cat::page_allocator pager;
+    auto allocator = cat::pool_allocator<16>::backed(pager, 4_ki).or_exit();
+
+    int4* p_int1 = allocator.alloc<int4>(1).verify();
+    int4* p_int2 = allocator.alloc<int4>(2).verify();
+    cat::verify(allocator.owns(p_int1));
+    cat::verify(allocator.owns(p_int2));
+    int4 local = 0;
+    cat::verify(!allocator.owns(&local));
+
+    // A freed node is recycled before any untouched node, even while there
+    // are still untouched nodes left.
+    allocator.free(p_int1);
+    int4* p_int3 = allocator.alloc<int4>(3).verify();
+    cat::verify(p_int3 == p_int1);
+    int4* p_int4 = allocator.alloc<int4>(4).verify();
+    cat::verify(p_int4 != p_int1 && p_int4 != p_int2);
+    cat::verify(*p_int2 == 2);
+
+    // Resetting forgets the free list, and starts over from the first node.
+    allocator.free(p_int2);
+    allocator.reset();
+    int4* p_int5 = allocator.alloc<int4>(5).verify();
+    cat::verify(p_int5 == p_int1);
+
+    // Every node can be allocated again after resetting.
+    for (int4 i = 1; i < 4_ki / 16; ++i) {
+        int4* p_int = allocator.alloc<int4>(i).verify();
+        cat::verify(allocator.owns(p_int));
+    }
+    cat::verify(!allocator.alloc<int4>().has_value());
+    allocator.reset();
+    cat::verify(allocator.alloc<int4>().verify() == p_int1);
+}
@@ -0,0 +1,41 @@
+#include <cat/page_allocator>
+#include <cat/ring>
+
+#include "../unit_tests.hpp"
+
+TEST(test_ring_pop) {
+    cat::page_allocator pager;
+    cat::ring<int4> ring_int4;
+    _ = ring_int4.reserve(pager, 4).verify();
+    defer(pager.free_multi(ring_int4.data(), 4u);)
+
+    cat::verify(!ring_int4.pop_front().has_value());
+    cat::verify(!ring_int4.pop_back().has_value());
+
+    // Fill the ring, then wrap around it. The ring holds 20, 3, 2, 0 in
+    // storage, and 3 is the oldest element because 20 overwrote 1.
+    ring_int4.push_back(1);
+    ring_int4.push_back(3);
+    ring_int4.push_back(2);
+    ring_int4.push_back(0);
+    ring_int4.push_back(20);
+
+    // Pop from both ends.
+    cat::verify(ring_int4.pop_front().value() == 3);
+    cat::verify(ring_int4.pop_back().value() == 20);
+    cat::verify(ring_int4.size() == 2);
+    cat::verify(ring_int4.pop_front().value() == 2);
+    cat::verify(ring_int4.pop_front().value() == 0);
+    cat::verify(!ring_int4.pop_front().has_value());
+    cat::verify(!ring_int4.pop_back().has_value());
+
+    // Popping from the back rewinds the next write, so pushing after it
+    // fills the same slot again.
+    ring_int4.push_back(7);
+    ring_int4.push_back(8);
+    cat::verify(ring_int4.pop_back().value() == 8);
+    ring_int4.push_back(9);
+    cat::verify(ring_int4.pop_front().value() == 7);
+    cat::verify(ring_int4.pop_front().value() == 9);
+    cat::verify(ring_int4.size() == 0);
+}
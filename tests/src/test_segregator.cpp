@@ -0,0 +1,47 @@
+#include <cat/page_allocator>
+#include <cat/pool_allocator>
+#include <cat/segregator>
+
+#include "../unit_tests.hpp"
+
+TEST(test_segregator) {
+    cat::page_allocator backing;
+    auto pool =
+        cat::pool_allocator<16>::backed(backing, 4_ki).or_exit();
+    cat::segregator<16u, cat::pool_allocator<16>, cat::page_allocator>
+        allocator(cat::move(pool), cat::page_allocator());
+    static_assert(decltype(allocator)::has_pointer_stability);
+
+    // Small allocations are served by the pool.
+    int4* p_small = allocator.alloc<int4>(1).or_exit();
+    cat::verify(allocator.small.owns(p_small));
+    cat::span small_array = allocator.alloc_multi<int4>(4u).or_exit();
+    cat::verify(allocator.small.owns(small_array.data()));
+
+    // Larger allocations are served by pages.
+    cat::span large_array = allocator.alloc_multi<int4>(1'000u).or_exit();
+    cat::verify(!allocator.small.owns(large_array.data()));
+    large_array[999] = 1;
+
+    // Frees are routed by size.
+    allocator.free(large_array);
+    allocator.free(small_array);
+    allocator.free(p_small);
+    int4* p_reused = allocator.alloc<int4>(2).or_exit();
+    cat::verify(p_reused == p_small);
+    cat::verify(*p_reused == 2);
+
+    // The pool rounds allocations up to 16 bytes, past this segregator's
+    // threshold. Size feedback is clamped to the threshold, so that freeing
+    // with it is still routed to the pool.
+    auto narrow_pool =
+        cat::pool_allocator<16>::backed(backing, 4_ki).or_exit();
+    cat::segregator<8u, cat::pool_allocator<16>, cat::page_allocator>
+        narrow(cat::move(narrow_pool), cat::page_allocator());
+    auto [bytes, bytes_count] = narrow.salloc_multi<cat::byte>(8u).or_exit();
+    cat::verify(narrow.small.owns(bytes.data()));
+    cat::verify(bytes_count == 8u);
+    narrow.free_multi(bytes.data(), bytes_count);
+    cat::span reused_bytes = narrow.alloc_multi<cat::byte>(8u).or_exit();
+    cat::verify(reused_bytes.data() == bytes.data());
+}
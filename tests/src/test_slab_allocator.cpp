@@ -0,0 +1,96 @@
+#include <cat/slab_allocator>
+
+#include "../unit_tests.hpp"
+
+TEST(test_slab_allocator) {
+    // Initialize an allocator.
+    cat::slab_allocator allocator;
+    defer(allocator.reset();)
+
+    // Sizes round up to the nearest size class.
+    cat::verify(cat::slab_allocator::size_class_of(1u) == 0u);
+    cat::verify(cat::slab_allocator::size_class_of(16u) == 0u);
+    cat::verify(cat::slab_allocator::size_class_of(17u) == 1u);
+    cat::verify(cat::slab_allocator::size_class_of(32_uki) == 11u);
+
+    // Make an allocation.
+    int4* p_int1 = allocator.alloc<int4>(10).verify();
+    cat::verify(*p_int1 == 10);
+
+    // Make another allocation, which must not alias the first.
+    int4* p_int2 = allocator.alloc<int4>(20).verify();
+    cat::verify(*p_int2 == 20);
+    cat::verify(*p_int1 == 10);
+    cat::verify(p_int1 != p_int2);
+
+    // Nodes of the smallest size class are 16 bytes apart.
+    cat::verify(cat::abs(intptr<int4>{p_int2} - intptr<int4>{p_int1}) == 16);
+
+    // A freed node is recycled by the next allocation in its size class.
+    allocator.free(p_int1);
+    int4* p_int3 = allocator.alloc<int4>(30).verify();
+    cat::verify(p_int3 == p_int1);
+    cat::verify(*p_int3 == 30);
+
+    // Size feedback reports the whole size class.
+    auto [array, array_bytes] = allocator.salloc_multi<int4>(5u).verify();
+    cat::verify(array_bytes == 32);
+    array[4] = 1;
+    allocator.free_multi(array.data(), 5u);
+
+    cat::verify(allocator.nalloc_multi<cat::byte>(100u).value() == 128);
+    cat::verify(allocator.nalloc_multi<cat::byte>(32_uki).value() == 32_uki);
+    cat::verify(allocator.nalloc_multi<cat::byte>(40_uki).value() == 40_uki);
+
+    // Nodes are aligned to their size class.
+    cat::span aligned = allocator.align_alloc_multi<int4>(64u, 16u).verify();
+    cat::verify(cat::is_aligned(aligned.data(), 64u));
+    allocator.free(aligned);
+
+    // An over-aligned small request is served from a larger size class, whose
+    // node is split back down to the requested size class.
+    cat::span over_aligned =
+        allocator.align_alloc_multi<cat::byte>(64u, 8u).verify();
+    cat::verify(cat::is_aligned(over_aligned.data(), 64u));
+    cat::verify(
+        allocator.align_nalloc_multi<cat::byte>(64u, 8u).value() == 16);
+    cat::byte* p_split_16 =
+        allocator.alloc_multi<cat::byte>(16u).verify().data();
+    cat::byte* p_split_32 =
+        allocator.alloc_multi<cat::byte>(32u).verify().data();
+    cat::verify(p_split_16 == over_aligned.data() + 16);
+    cat::verify(p_split_32 == over_aligned.data() + 32);
+
+    // Freeing it with its requested size returns the whole node.
+    allocator.free(over_aligned);
+    cat::verify(allocator.alloc_multi<cat::byte>(8u).verify().data() ==
+                over_aligned.data());
+    allocator.free_multi(p_split_16, 16u);
+    allocator.free_multi(p_split_32, 32u);
+
+    // Slab headers are kept out of band, so every node of the largest size
+    // class's first slab is contiguous.
+    cat::byte* p_largest =
+        allocator.alloc_multi<cat::byte>(32_uki).verify().data();
+    for (int4 i = 1; i < 16; ++i) {
+        cat::byte* p_next =
+            allocator.alloc_multi<cat::byte>(32_uki).verify().data();
+        cat::verify(p_next == p_largest + 32'768);
+        p_largest = p_next;
+    }
+
+    // Fill several slabs of one size class.
+    for (int4 i = 0; i < 10'000; ++i) {
+        _ = allocator.alloc_multi<cat::byte>(100u).verify();
+    }
+
+    // Large allocations bypass the size classes.
+    cat::span large = allocator.alloc_multi<cat::byte>(100_uki).verify();
+    large[100_uki - 1u] = cat::byte(1);
+    allocator.free(large);
+
+    // Make an allocation after resetting.
+    allocator.reset();
+    int4* p_int4 = allocator.alloc<int4>(40).verify();
+    cat::verify(*p_int4 == 40);
+}
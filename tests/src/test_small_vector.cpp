@@ -0,0 +1,112 @@
+#include <cat/linear_allocator>
+#include <cat/page_allocator>
+#include <cat/small_vector>
+
+#include "../unit_tests.hpp"
+
+namespace {
+// This is not trivially relocatable, so it is relocated element-wise.
+struct tag {
+    tag(int4 in_value) : value(in_value) {
+    }
+
+    int4 value;
+};
+}  // namespace
+
+TEST(test_small_vector) {
+    cat::page_allocator pager;
+    cat::mem auto page = pager.opq_alloc_multi<cat::byte>(4_uki - 32u).or_exit();
+    defer(pager.free(page);)
+    auto allocator = cat::linear_allocator::backed_handle(pager, page);
+
+    // The default inline capacity fills 256 bytes.
+    static_assert(cat::detail::small_vector_default_capacity<int4> == 64u);
+    static_assert(cat::detail::small_vector_default_capacity<
+                      cat::array<cat::byte, 512u>> == 1u);
+
+    // Elements up to the inline capacity do not allocate.
+    cat::small_vector<int4, 4u> small_vec;
+    cat::verify(small_vec.is_empty());
+    cat::verify(small_vec.capacity() == 4u);
+    for (int4 i = 0; i < 4; ++i) {
+        small_vec.push_back(allocator, i).or_exit();
+    }
+    cat::verify(small_vec.is_inline());
+    cat::verify(small_vec.size() == 4u);
+
+    // Reserving within the inline capacity does nothing.
+    small_vec.reserve(allocator, 2u).or_exit();
+    cat::verify(small_vec.is_inline());
+
+    // The next element spills every element into the allocator.
+    small_vec.push_back(allocator, 4).or_exit();
+    cat::verify(!small_vec.is_inline());
+    cat::verify(small_vec.size() == 5u);
+    cat::verify(small_vec.capacity() >= 8u);
+    cat::verify(small_vec[0] == 0 && small_vec[3] == 3 && small_vec[4] == 4);
+
+    // Test resizing a `small_vector`.
+    small_vec.resize(allocator, 2u).or_exit();
+    cat::verify(small_vec.size() == 2u);
+    cat::verify(small_vec.capacity() >= 8u);
+
+    // Growing constructs new elements, even over storage that held dropped
+    // ones.
+    small_vec.resize(allocator, 4u).or_exit();
+    cat::verify(small_vec.size() == 4u);
+    cat::verify(small_vec[1] == 1 && small_vec[2] == 0 && small_vec[3] == 0);
+    small_vec.resize(allocator, 2u).or_exit();
+
+    cat::small_vector<int4, 4u> resized_vec;
+    resized_vec.resize(allocator, 3u).or_exit();
+    cat::verify(resized_vec.is_inline());
+    cat::verify(resized_vec[0] == 0 && resized_vec[2] == 0);
+
+    // Test appending a `span`.
+    int4 numbers[3] = {7, 8, 9};
+    small_vec.append(allocator, cat::span<int4>(numbers, 3u)).or_exit();
+    cat::verify(small_vec.size() == 5u);
+    cat::verify(small_vec[1] == 1 && small_vec[2] == 7 && small_vec[4] == 9);
+
+    // Test the filled and reserved constructors.
+    auto filled_vec =
+        cat::small_vector<int4, 4u>::filled(allocator, 3u, 1).or_exit();
+    cat::verify(filled_vec.is_inline());
+    cat::verify(filled_vec.size() == 3u);
+    for (int4 integer : filled_vec) {
+        cat::verify(integer == 1);
+    }
+
+    auto reserved_vec =
+        cat::small_vector<int4, 4u>::reserved(allocator, 16).or_exit();
+    cat::verify(!reserved_vec.is_inline());
+    cat::verify(reserved_vec.capacity() >= 16u);
+
+    // Test cloning a `small_vector`, both inline and spilled.
+    auto cloned_vec = filled_vec.clone(allocator).or_exit();
+    cat::verify(cloned_vec.is_inline());
+    cat::verify(cloned_vec.size() == 3u && cloned_vec[2] == 1);
+
+    auto cloned_spilled_vec = small_vec.clone(allocator).or_exit();
+    cat::verify(cloned_spilled_vec.size() == 5u);
+    cat::verify(cloned_spilled_vec[4] == 9);
+
+    // Moving an inline `small_vector` relocates its elements.
+    cat::small_vector<tag, 2u> tags;
+    tags.emplace_back(allocator, 1).or_exit();
+    tags.push_back(allocator, tag(2)).or_exit();
+    cat::small_vector<tag, 2u> moved_tags = cat::move(tags);
+    cat::verify(moved_tags.is_inline());
+    cat::verify(moved_tags.size() == 2u);
+    cat::verify(moved_tags[0].value == 1 && moved_tags[1].value == 2);
+    cat::verify(tags.is_empty());
+
+    // Moving a spilled `small_vector` takes its allocation.
+    moved_tags.emplace_back(allocator, 3).or_exit();
+    tag const* p_tags = moved_tags.data();
+    cat::small_vector<tag, 2u> spilled_tags = cat::move(moved_tags);
+    cat::verify(!spilled_tags.is_inline());
+    cat::verify(spilled_tags.data() == p_tags);
+    cat::verify(spilled_tags[2].value == 3);
+}
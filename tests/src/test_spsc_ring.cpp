@@ -0,0 +1,135 @@
+#include <cat/atomic>
+#include <cat/page_allocator>
+#include <cat/runtime>
+#include <cat/spsc_ring>
+#include <cat/thread>
+
+#include "../unit_tests.hpp"
+
+namespace {
+
+constexpr int4 spsc_elements_count = 100'000;
+
+struct spsc_stress_arguments {
+    cat::spsc_ring<int4>* p_ring;
+    cat::atomic<bool> is_finished = false;
+};
+
+// Push every integer up to `spsc_elements_count` in order, alternating
+// between single pushes and batches.
+void spsc_produce(void* p_arguments) {
+    spsc_stress_arguments& arguments =
+        *static_cast<spsc_stress_arguments*>(p_arguments);
+    cat::spsc_ring<int4>& ring = *arguments.p_ring;
+
+    int4::raw_type next = 0;
+    int4 batch[7];
+    while (next < spsc_elements_count) {
+        if (next % 2 == 0) {
+            if (ring.push(int4(next))) {
+                ++next;
+            } else {
+                cat::relax_cpu();
+            }
+            continue;
+        }
+
+        int4::raw_type const batch_size =
+            cat::min(7, spsc_elements_count.raw - next);
+        for (int4::raw_type i = 0; i < batch_size; ++i) {
+            batch[i] = next + i;
+        }
+        idx const pushed = ring.push_n(cat::span<int4>(
+            batch, static_cast<uword::raw_type>(batch_size)));
+        next += static_cast<int4::raw_type>(pushed.raw);
+        if (pushed == 0u) {
+            cat::relax_cpu();
+        }
+    }
+
+    arguments.is_finished.store(true, cat::memory_order::release);
+    cat::exit();
+}
+
+}  // namespace
+
+TEST(test_spsc_ring) {
+    cat::page_allocator pager;
+
+    // Test pushing and popping on one thread.
+    cat::spsc_ring<int4> ring;
+    defer(ring.free(pager);)
+    cat::verify(ring.capacity() == 0u);
+    ring.reserve(pager, 4u).or_exit();
+    cat::verify(ring.capacity() == 4u);
+    cat::verify(ring.is_empty());
+    cat::verify(!ring.pop().has_value());
+
+    cat::verify(ring.push(1));
+    cat::verify(ring.push(2));
+    cat::verify(ring.emplace(3));
+    cat::verify(ring.push(4));
+    cat::verify(ring.size() == 4u);
+    // A full ring rejects pushes instead of overwriting.
+    cat::verify(!ring.push(5));
+    cat::verify(ring.pop().verify() == 1);
+    cat::verify(ring.pop().verify() == 2);
+    cat::verify(ring.push(5));
+    cat::verify(ring.size() == 3u);
+
+    // Batches wrap around the end of the storage, and only as many elements
+    // as fit are pushed.
+    int4 values[4] = {6, 7, 8, 9};
+    cat::verify(ring.push_n(cat::span<int4>(values, 4u)) == 1u);
+    int4 popped[8] = {};
+    cat::verify(ring.pop_n(cat::span<int4>(popped, 8u)) == 4u);
+    cat::verify(popped[0] == 3 && popped[1] == 4 && popped[2] == 5 &&
+                popped[3] == 6);
+    cat::verify(ring.is_empty());
+    cat::verify(ring.pop_n(cat::span<int4>(popped, 8u)) == 0u);
+    cat::verify(ring.push_n(cat::span<int4>(values, 4u)) == 4u);
+    cat::verify(ring.pop_n(cat::span<int4>(popped, 2u)) == 2u);
+    cat::verify(popped[0] == 6 && popped[1] == 7);
+    cat::verify(ring.pop().verify() == 8);
+    cat::verify(ring.pop().verify() == 9);
+    ring.free(pager);
+
+    // Pass elements between two threads. The consumer must see every element
+    // exactly once, in order.
+    ring.reserve(pager, 64u).or_exit();
+    spsc_stress_arguments arguments;
+    arguments.p_ring = &ring;
+    cat::thread producer;
+    producer.create(pager, 64_uki, spsc_produce, &arguments)
+        .or_exit("Failed to make thread!");
+
+    int4 expected = 0;
+    int4 batch[5];
+    while (expected < spsc_elements_count) {
+        if (expected % 3 == 0) {
+            cat::maybe value = ring.pop();
+            if (value.has_value()) {
+                cat::verify(value.value() == expected);
+                ++expected;
+            } else {
+                cat::relax_cpu();
+            }
+            continue;
+        }
+
+        idx const popped_count = ring.pop_n(cat::span<int4>(batch, 5u));
+        for (idx i = 0u; i < popped_count; ++i) {
+            cat::verify(batch[i.raw] == expected);
+            ++expected;
+        }
+        if (popped_count == 0u) {
+            cat::relax_cpu();
+        }
+    }
+
+    producer.join().or_exit("Failed to join thread!");
+    while (!arguments.is_finished.load(cat::memory_order::acquire)) {
+        cat::relax_cpu();
+    }
+    cat::verify(ring.is_empty());
+}
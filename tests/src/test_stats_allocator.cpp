@@ -0,0 +1,47 @@
+#include <cat/inline_allocator>
+#include <cat/slab_allocator>
+#include <cat/stats_allocator>
+
+#include "../unit_tests.hpp"
+
+TEST(test_stats_allocator) {
+    cat::inline_allocator<256u> backing;
+    cat::stats_allocator allocator(backing);
+
+    int4* p_int = allocator.alloc<int4>().or_exit();
+    cat::span array = allocator.alloc_multi<int4>(32u).or_exit();
+
+    // This is larger than the backing allocator, so it fails.
+    cat::verify(!allocator.alloc_multi<int4>(100u).has_value());
+
+    cat::allocator_stats stats = allocator.stats();
+    cat::verify(stats.allocations == 2u);
+    cat::verify(stats.failed_allocations == 1u);
+    cat::verify(stats.live_bytes == 132u);
+    cat::verify(stats.peak_bytes == 132u);
+    // 4 bytes are in the smallest bucket, and 128 bytes are in the fourth.
+    cat::verify(stats.histogram[0] == 1u);
+    cat::verify(stats.histogram[3] == 1u);
+
+    allocator.free(array);
+    allocator.free(p_int);
+    stats = allocator.stats();
+    cat::verify(stats.frees == 2u);
+    cat::verify(stats.live_bytes == 0u);
+    cat::verify(stats.peak_bytes == 132u);
+
+    cat::verify(allocator.dump().has_value());
+
+    // A slab allocator rounds 20 bytes up to 32, but size feedback reports
+    // the 20 bytes that were counted, so freeing with it balances them.
+    cat::slab_allocator slabs;
+    defer(slabs.reset();)
+    cat::stats_allocator slab_stats(slabs);
+    auto [rounded, rounded_bytes] =
+        slab_stats.salloc_multi<int4>(5u).or_exit();
+    cat::verify(rounded_bytes == 20u);
+    cat::verify(slab_stats.stats().live_bytes == 20u);
+    slab_stats.free_multi(rounded.data(), rounded_bytes / sizeof(int4));
+    cat::verify(slab_stats.stats().live_bytes == 0u);
+    cat::verify(slab_stats.stats().peak_bytes == 20u);
+}
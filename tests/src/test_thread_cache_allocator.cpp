@@ -0,0 +1,124 @@
+#include <cat/atomic>
+#include <cat/page_allocator>
+#include <cat/runtime>
+#include <cat/thread>
+#include <cat/thread_cache_allocator>
+
+#include "../unit_tests.hpp"
+
+namespace {
+
+struct remote_free_arguments {
+    cat::thread_cache_heap<cat::page_allocator>* p_heap;
+    int4* p_allocation;
+    cat::atomic<bool> is_finished = false;
+};
+
+// Free another thread's block through this thread's own cache.
+void free_remotely(void* p_arguments) {
+    remote_free_arguments& arguments =
+        *static_cast<remote_free_arguments*>(p_arguments);
+    cat::thread_cache_allocator cache(*arguments.p_heap);
+    cache.free(arguments.p_allocation);
+    cache.flush();
+    arguments.is_finished.store(true, cat::memory_order::release);
+    cat::exit();
+}
+
+}  // namespace
+
+TEST(test_thread_cache_allocator) {
+    // Initialize a heap shared between two thread caches.
+    cat::page_allocator pager;
+    cat::thread_cache_heap heap(pager);
+    defer(heap.reset();)
+    cat::thread_cache_allocator cache_1(heap);
+    cat::thread_cache_allocator cache_2(heap);
+
+    // Make an allocation.
+    int4* p_int1 = cache_1.alloc<int4>(10).verify();
+    cat::verify(*p_int1 == 10);
+
+    // Make another allocation, which must not alias the first.
+    int4* p_int2 = cache_1.alloc<int4>(20).verify();
+    cat::verify(*p_int2 == 20);
+    cat::verify(*p_int1 == 10);
+
+    // Block storage is 16-byte aligned.
+    cat::verify(cat::is_aligned(p_int1, 16u));
+    cat::verify(cat::is_aligned(p_int2, 16u));
+
+    // A block freed by its owner is recycled by the owner's next allocation.
+    cache_1.free(p_int1);
+    int4* p_int3 = cache_1.alloc<int4>(30).verify();
+    cat::verify(p_int3 == p_int1);
+
+    // A block freed by another cache returns to its owner, rather than to the
+    // cache that freed it.
+    cache_2.free(p_int3);
+    int4* p_int4 = cache_2.alloc<int4>(40).verify();
+    cat::verify(p_int4 != p_int3);
+
+    // Empty `cache_1`'s magazine, so that it collects its remote frees.
+    bool was_reclaimed = false;
+    for (int4 i = 0; i < 64; ++i) {
+        int4* p_int = cache_1.alloc<int4>().verify();
+        was_reclaimed = was_reclaimed || (p_int == p_int3);
+    }
+    cat::verify(was_reclaimed);
+
+    // Size feedback reports the whole size class.
+    auto [array, array_bytes] = cache_1.salloc_multi<int4>(5u).verify();
+    cat::verify(array_bytes == 32);
+    cache_1.free_multi(array.data(), 5u);
+
+    // Churn through enough blocks to refill and drain magazines.
+    int4* allocations[200];
+    for (int4::raw_type i = 0; i < 200; ++i) {
+        allocations[i] = cache_1.alloc<int4>(i).verify();
+    }
+    for (int4::raw_type i = 0; i < 200; ++i) {
+        cat::verify(*allocations[i] == i);
+        cache_2.free(allocations[i]);
+    }
+
+    // Large allocations bypass the size classes.
+    cat::span large = cache_2.alloc_multi<cat::byte>(16_uki).verify();
+    large[16_uki - 1u] = cat::byte(1);
+    cache_1.free(large);
+
+    // Over-aligned allocations also bypass the size classes, even when they
+    // are small.
+    cat::span aligned = cache_1.align_alloc_multi<int4>(64u, 2u).verify();
+    cat::verify(cat::is_aligned(aligned.data(), 64u));
+    aligned[1] = 1;
+    cache_2.free(aligned);
+    cat::span page_aligned =
+        cache_1.align_alloc_multi<cat::byte>(4_uki, 8_uki).verify();
+    cat::verify(cat::is_aligned(page_aligned.data(), 4_uki));
+    page_aligned[8_uki - 1u] = cat::byte(1);
+    cache_1.free(page_aligned);
+
+    // Free a block on another thread. Its owner reclaims it once its
+    // magazine runs dry.
+    cache_1.flush();
+    remote_free_arguments arguments;
+    arguments.p_heap = &heap;
+    arguments.p_allocation = cache_1.alloc<int4>(50).verify();
+    cat::thread thread;
+    thread.create(pager, 64_uki, free_remotely, &arguments)
+        .or_exit("Failed to make thread!");
+    thread.join().or_exit("Failed to join thread!");
+    while (!arguments.is_finished.load(cat::memory_order::acquire)) {
+        cat::relax_cpu();
+    }
+    was_reclaimed = false;
+    for (int4 i = 0; i < 64; ++i) {
+        int4* p_int = cache_1.alloc<int4>().verify();
+        was_reclaimed = was_reclaimed || (p_int == arguments.p_allocation);
+    }
+    cat::verify(was_reclaimed);
+
+    cache_1.flush();
+    cache_2.flush();
+}
@@ -0,0 +1,103 @@
+#include <cat/atomic>
+#include <cat/linux>
+#include <cat/thread>
+
+#include "../unit_tests.hpp"
+
+namespace {
+void count_and_exit(void* p_args) {
+    static_cast<cat::atomic<int4>*>(p_args)->fetch_add(
+        1, cat::memory_order::release);
+    cat::exit();
+}
+
+// Write to a local variable at the top of this thread's stack, and report its
+// address.
+void write_stack_top(void* p_args) {
+    cat::atomic<cat::byte*>& local_address =
+        *static_cast<cat::atomic<cat::byte*>*>(p_args);
+    cat::byte local = cat::byte(1);
+    // Prevent this from being optimized out.
+    asm volatile("" ::"m"(local) : "memory");
+    local_address.store(&local, cat::memory_order::release);
+    cat::exit();
+}
+}  // namespace
+
+TEST(test_thread_stack_pool) {
+    cat::thread_stack_pool pool;
+    pool.map(2u, 16_uki).or_exit("Failed to map stacks!");
+    defer(pool.unmap();)
+    cat::verify(pool.stack_size() == 16_uki);
+
+    // Every stack is handed out once, then the pool is empty.
+    cat::span<cat::byte> stack_1 = pool.acquire().verify();
+    cat::span<cat::byte> stack_2 = pool.acquire().verify();
+    cat::verify(!pool.acquire().has_value());
+    cat::verify(stack_1.data() != stack_2.data());
+    cat::verify(pool.owns(stack_1.data()) && pool.owns(stack_2.data()));
+
+    // Neighboring stacks are separated by a guard page.
+    cat::byte* p_low = stack_1.data() < stack_2.data() ? stack_1.data()
+                                                       : stack_2.data();
+    cat::byte* p_high = stack_1.data() < stack_2.data() ? stack_2.data()
+                                                        : stack_1.data();
+    cat::verify(p_high - p_low ==
+                (pool.stack_size() + cat::thread_stack_pool::guard_bytes).raw);
+
+    cat::verify(!pool.owns(p_high + pool.stack_size().raw));
+    pool.release(stack_1);
+    pool.release(stack_2);
+
+    // Joining a thread recycles its stack, so the same stack is used again.
+    cat::atomic<int4> finished = 0;
+    cat::byte* p_recycled = nullptr;
+    for (int4 i = 0; i < 4; ++i) {
+        cat::thread thread;
+        thread.create(pool, count_and_exit, &finished)
+            .or_exit("Failed to make thread!");
+        thread.join().or_exit("Failed to join thread!");
+
+        cat::span<cat::byte> stack = pool.acquire().verify();
+        if (p_recycled != nullptr) {
+            cat::verify(stack.data() == p_recycled);
+        }
+        p_recycled = stack.data();
+        pool.release(stack);
+    }
+    cat::verify(finished.load(cat::memory_order::acquire) == 4);
+
+    // Threads that outnumber the stacks cannot be created until one is joined.
+    cat::thread thread_1;
+    cat::thread thread_2;
+    cat::thread thread_3;
+    thread_1.create(pool, count_and_exit, &finished)
+        .or_exit("Failed to make thread!");
+    thread_2.create(pool, count_and_exit, &finished)
+        .or_exit("Failed to make thread!");
+    cat::verify(!thread_3.create(pool, count_and_exit, &finished).has_value());
+    thread_1.join().or_exit("Failed to join thread!");
+    thread_3.create(pool, count_and_exit, &finished)
+        .or_exit("Failed to make thread!");
+    thread_2.join().or_exit("Failed to join thread!");
+    thread_3.join().or_exit("Failed to join thread!");
+    cat::verify(finished.load(cat::memory_order::acquire) == 7);
+
+    // The top of the last stack in a pool is the end of its mapping, so a
+    // thread that starts there must not touch the memory above it.
+    cat::thread_stack_pool last_pool;
+    last_pool.map(1u, 16_uki).or_exit("Failed to map stacks!");
+    defer(last_pool.unmap();)
+    cat::span<cat::byte> last_stack = last_pool.acquire().verify();
+    last_pool.release(last_stack);
+
+    cat::atomic<cat::byte*> local_address = nullptr;
+    cat::thread top_thread;
+    top_thread.create(last_pool, write_stack_top, &local_address)
+        .or_exit("Failed to make thread!");
+    top_thread.join().or_exit("Failed to join thread!");
+    cat::byte* p_local = local_address.load(cat::memory_order::acquire);
+    cat::verify(p_local >= last_stack.data());
+    cat::verify(p_local < last_stack.data() + last_stack.size().raw);
+    cat::verify(last_stack.data() + last_stack.size().raw - p_local < 256);
+}
@@ -0,0 +1,60 @@
+#include <cat/bit>
+#include <cat/page_allocator>
+#include <cat/tlsf_allocator>
+
+#include "../unit_tests.hpp"
+
+TEST(test_tlsf_allocator) {
+    cat::page_allocator pager;
+    auto allocator = cat::tlsf_allocator::backed(pager, 64_uki).or_exit();
+
+    // Allocations are rounded up to 16 bytes.
+    auto first = allocator.salloc_multi<int4>(3u).or_exit();
+    cat::verify(first.second() == 16u);
+    int4* p_first = first.first().data();
+    p_first[2] = 3;
+
+    // Over-aligned allocations skip a gap, which is freed as its own block.
+    int4* p_aligned = allocator.align_alloc<int4>(256u, 2).or_exit();
+    cat::verify(cat::is_aligned(p_aligned, 256u));
+    cat::verify(*p_aligned == 2);
+    cat::verify(p_first[2] == 3);
+
+    // Freed blocks are merged with their neighbors, so freeing everything
+    // leaves one block that holds nearly the entire arena.
+    allocator.free(p_aligned);
+    allocator.free_multi(p_first, 3u);
+    cat::span whole = allocator.alloc_multi<cat::byte>(60_uki).or_exit();
+    cat::verify(allocator.owns(whole.data()));
+    cat::verify(!allocator.alloc_multi<cat::byte>(8_uki).has_value());
+    allocator.free(whole);
+
+    // Free every other allocation of many sizes, and check that nothing
+    // overlaps.
+    int4* p_ints[64];
+    for (int i = 0; i < 64; ++i) {
+        p_ints[i] =
+            allocator.alloc_multi<int4>(cat::idx(1 + i * 7)).or_exit().data();
+        p_ints[i][0] = i;
+    }
+    for (int i = 0; i < 64; i += 2) {
+        allocator.free_multi(p_ints[i], cat::idx(1 + i * 7));
+    }
+    for (int i = 1; i < 64; i += 2) {
+        cat::verify(p_ints[i][0] == i);
+    }
+
+    // A block grows in place by absorbing the free block after it.
+    allocator.reset();
+    cat::span array = allocator.alloc_multi<int4>(4u).or_exit();
+    array[3] = 4;
+    cat::span grown_array =
+        allocator.realloc_multi<int4>(array.data(), 4u, 1'000u).or_exit();
+    cat::verify(grown_array.data() == array.data());
+    cat::verify(grown_array[3] == 4);
+    cat::verify(grown_array[999] == 0);
+
+    // After a reset, the whole arena is available again.
+    allocator.reset();
+    cat::verify(allocator.alloc_multi<cat::byte>(60_uki).has_value());
+}
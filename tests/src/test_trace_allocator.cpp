@@ -0,0 +1,58 @@
+#include <cat/page_allocator>
+#include <cat/trace_allocator>
+
+#include "../unit_tests.hpp"
+
+TEST(test_trace_allocator) {
+    cat::page_allocator backing;
+    auto tracer =
+        cat::trace_allocator<cat::page_allocator>::traced(backing, backing, 16)
+            .or_exit();
+
+    int4* p_int = tracer.at().alloc<int4>().or_exit();
+    unsigned long const allocation_line = __LINE__ - 1;
+    cat::span array = tracer.alloc_multi<int4>(4u).or_exit();
+    array[3] = 1;
+    cat::span grown_array =
+        tracer.realloc_multi<int4>(array.data(), 4u, 8u).or_exit();
+    cat::verify(grown_array[3] == 1);
+    tracer.free(p_int);
+
+    // Drain the trace, oldest event first.
+    cat::allocation_event events[4];
+    for (cat::allocation_event& event : events) {
+        event = tracer.pop_event().or_exit();
+    }
+    cat::verify(!tracer.pop_event().has_value());
+
+    cat::verify(events[0].kind == cat::allocation_event_kind::allocate);
+    cat::verify(events[0].p_address == p_int);
+    cat::verify(events[0].bytes == 4u);
+    cat::verify(events[0].callsite.line() == allocation_line);
+    cat::verify(events[1].kind == cat::allocation_event_kind::allocate);
+    cat::verify(events[1].callsite.line() == 0u);
+    cat::verify(events[2].kind == cat::allocation_event_kind::reallocate);
+    cat::verify(events[2].p_old_address == array.data());
+    cat::verify(events[2].p_address == grown_array.data());
+    cat::verify(events[2].bytes == 32u);
+    cat::verify(events[3].kind == cat::allocation_event_kind::deallocate);
+    cat::verify(events[3].p_address == p_int);
+    for (idx i = 1u; i < 4u; ++i) {
+        cat::verify(events[i.raw].timestamp >= events[i.raw - 1].timestamp);
+    }
+
+    // Replay the trace against another allocator. The grown array is never
+    // freed, so 32 bytes are live at the peak, in addition to the `int4`.
+    // Each of those occupies a whole page in the replay target.
+    cat::page_allocator replay_target;
+    cat::trace_replay_result result =
+        cat::replay_trace(replay_target,
+                          cat::span<cat::allocation_event const>(events, 4u),
+                          backing)
+            .or_exit();
+    cat::verify(result.failed_allocations == 0u);
+    cat::verify(result.peak_requested_bytes == 36u);
+    cat::verify(result.peak_allocated_bytes == 8_uki);
+
+    tracer.free(grown_array);
+}
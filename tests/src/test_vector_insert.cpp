@@ -0,0 +1,99 @@
+#include <cat/page_allocator>
+#include <cat/vector>
+
+#include "../unit_tests.hpp"
+
+namespace {
+// This is not trivially relocatable, so it is inserted element-wise.
+struct point {
+    point(int4 in_x, int4 in_y) : x(in_x), y(in_y) {
+    }
+
+    int4 x;
+    int4 y;
+};
+
+// This is default-constructible, but not trivially relocatable.
+struct label {
+    label() : value(7) {
+    }
+
+    label(int4 in_value) : value(in_value) {
+    }
+
+    int4 value;
+};
+}  // namespace
+
+TEST(test_vector_insert) {
+    cat::page_allocator allocator;
+
+    // Test emplacing and moving elements onto a `vector`.
+    cat::vector<point> points;
+    points.emplace_back(allocator, 1, 2).or_exit();
+    points.push_back(allocator, point(3, 4)).or_exit();
+    cat::verify(points.size() == 2u);
+    cat::verify(points[0].x == 1 && points[0].y == 2);
+    cat::verify(points[1].x == 3 && points[1].y == 4);
+
+    // Test appending a `span` to a `vector`.
+    int4 numbers[6] = {1, 2, 3, 4, 5, 6};
+    cat::vector<int4> bulk_vec;
+    bulk_vec.append(allocator, cat::span<int4>(numbers, 6u)).or_exit();
+    bulk_vec.append(allocator, cat::span<int4>(numbers, 3u)).or_exit();
+    cat::verify(bulk_vec.size() == 9u);
+    cat::verify(bulk_vec[5] == 6);
+    cat::verify(bulk_vec[8] == 3);
+
+    // Test inserting a range into the middle of a `vector`. The tail is
+    // longer than the range, so it overlaps where it is moved up to.
+    cat::span<int4> const insertion(numbers + 4, 2u);
+    bulk_vec.insert(allocator, 1u, insertion.begin(), insertion.end())
+        .or_exit();
+    cat::verify(bulk_vec.size() == 11u);
+    int4 const expected[11] = {1, 5, 6, 2, 3, 4, 5, 6, 1, 2, 3};
+    for (idx i = 0u; i < 11u; ++i) {
+        cat::verify(bulk_vec[i] == expected[i.raw]);
+    }
+
+    // Inserting an empty range does nothing.
+    bulk_vec.insert(allocator, 0u, insertion.begin(), insertion.begin())
+        .or_exit();
+    cat::verify(bulk_vec.size() == 11u);
+
+    // A reversed range is random access, but not contiguous in order, so its
+    // elements must be copied one at a time.
+    cat::span<int4> const reversed(numbers, 3u);
+    bulk_vec.insert(allocator, 11u, reversed.rbegin(), reversed.rend())
+        .or_exit();
+    cat::verify(bulk_vec.size() == 14u);
+    cat::verify(bulk_vec[11] == 3 && bulk_vec[12] == 2 && bulk_vec[13] == 1);
+
+    // A range of pointers is copied at once.
+    bulk_vec.insert(allocator, 0u, numbers + 1, numbers + 3).or_exit();
+    cat::verify(bulk_vec.size() == 16u);
+    cat::verify(bulk_vec[0] == 2 && bulk_vec[1] == 3 && bulk_vec[2] == 1);
+
+    // Test inserting elements which are not trivially relocatable.
+    cat::vector<point> more_points;
+    more_points.emplace_back(allocator, 5, 6).or_exit();
+    more_points.emplace_back(allocator, 7, 8).or_exit();
+    points.insert(allocator, 1u, more_points.begin(), more_points.end())
+        .or_exit();
+    cat::verify(points.size() == 4u);
+    cat::verify(points[0].x == 1 && points[1].x == 5 && points[2].x == 7 &&
+                points[3].x == 3);
+
+    // Growing a `vector` by resizing it constructs its new elements.
+    cat::vector<label> labels;
+    labels.emplace_back(allocator, 1).or_exit();
+    labels.resize(allocator, 9u).or_exit();
+    cat::verify(labels.size() == 9u);
+    cat::verify(labels[0].value == 1);
+    for (idx i = 1u; i < 9u; ++i) {
+        cat::verify(labels[i].value == 7);
+    }
+    labels.resize(allocator, 2u).or_exit();
+    cat::verify(labels.size() == 2u);
+    cat::verify(labels[1].value == 7);
+}
@@ -0,0 +1,51 @@
+#include <cat/virtual_arena>
+
+#include "../unit_tests.hpp"
+
+namespace {
+
+// This is default-constructed without initializing its storage, so that
+// allocating it reads whatever the arena's memory already holds.
+struct uninitialized_int {
+    // NOLINTNEXTLINE This must not be `default`ed.
+    uninitialized_int() {
+    }
+
+    int4::raw_type value;
+};
+
+}  // namespace
+
+TEST(test_virtual_arena) {
+    // Reserve far more memory than this test uses.
+    cat::virtual_arena arena = cat::virtual_arena::reserved(1_ugi).verify();
+    defer(arena.release();)
+
+    // Make an allocation.
+    int4* p_int1 = arena.alloc<int4>(10).verify();
+    cat::verify(*p_int1 == 10);
+
+    // Make another allocation after the first.
+    int4* p_int2 = arena.alloc<int4>(20).verify();
+    cat::verify(*p_int2 == 20);
+    cat::verify(p_int2 == p_int1 + 1);
+
+    // Allocations are aligned.
+    cat::span aligned = arena.align_alloc_multi<cat::byte>(256u, 3u).verify();
+    cat::verify(cat::is_aligned(aligned.data(), 256u));
+
+    // Commit many pages at once.
+    cat::span large = arena.alloc_multi<cat::byte>(100_umi).verify();
+    large[0] = cat::byte(1);
+    large[100_umi - 1u] = cat::byte(1);
+
+    // Allocations cannot exceed the reservation.
+    cat::verify(!arena.alloc_multi<cat::byte>(1_ugi).has_value());
+
+    // Memory is reused and zero-filled after resetting.
+    *p_int1 = 30;
+    arena.reset();
+    uninitialized_int* p_int3 = arena.alloc<uninitialized_int>().verify();
+    cat::verify(static_cast<void*>(p_int3) == static_cast<void*>(p_int1));
+    cat::verify(p_int3->value == 0);
+}
@@ -1,5 +1,6 @@
 #include <cat/debug>
 #include <cat/format>
+#include <cat/inline_allocator>
 #include <cat/page_allocator>
 
 // All unit tests have access to these symbols:
@@ -20,8 +21,8 @@ void test_fail(cat::source_location const& source_location);
         _ = cat::print("Running test ");                                    \
         last_ctor_was_test = true;                                          \
         ++tests_run;                                                        \
-        /* TODO: This will leak. An `Inlineallocator` should be used. */    \
-        _ = cat::print(cat::format(pager, "{}", tests_run).value());        \
+        cat::inline_allocator<128u> allocator;                              \
+        _ = cat::print(cat::format(allocator, "{}", tests_run).value());    \
         /* TODO: Align the whitespace after `:` for 1 and 2 digit tests. */ \
         auto string = ": " #test_name "...\n";                              \
         _ = cat::print(string);                                             \